@@ -166,8 +166,24 @@ extern "C"
     #define BIT62     (M_BitN((uint64_t)62))
     #define BIT63     (M_BitN((uint64_t)63))
 
+    //NOTE: ~0 is an int, so this only works for ranges below bit 31. Use get_Bit_Range_64() (or the 8/16/32 versions) for anything wider.
     #define M_GETBITRANGE(input, msb, lsb) (((input) >> (lsb)) & ~(~0 << ((msb) - (lsb) + 1)))
 
+    //Byte swap a single value. These use the compiler's intrinsics when we know about them since they compile down to a single instruction (bswap, rev, etc). Otherwise they fall back to masks and shifts.
+    #if (defined (__GNUC__) && ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 8))) || defined (__clang__)
+        #define M_ByteSwap16(w)   ( (uint16_t)__builtin_bswap16((uint16_t)(w)) )
+        #define M_ByteSwap32(d)   ( (uint32_t)__builtin_bswap32((uint32_t)(d)) )
+        #define M_ByteSwap64(q)   ( (uint64_t)__builtin_bswap64((uint64_t)(q)) )
+    #elif defined (_MSC_VER)
+        #define M_ByteSwap16(w)   ( (uint16_t)_byteswap_ushort((uint16_t)(w)) )
+        #define M_ByteSwap32(d)   ( (uint32_t)_byteswap_ulong((uint32_t)(d)) )
+        #define M_ByteSwap64(q)   ( (uint64_t)_byteswap_uint64((uint64_t)(q)) )
+    #else
+        #define M_ByteSwap16(w)   ( (uint16_t)( (((uint16_t)(w) & 0x00FFU) << 8) | (((uint16_t)(w) & 0xFF00U) >> 8) ) )
+        #define M_ByteSwap32(d)   ( (uint32_t)( ((uint32_t)M_ByteSwap16(M_Word0(d)) << 16) | (uint32_t)M_ByteSwap16(M_Word1(d)) ) )
+        #define M_ByteSwap64(q)   ( (uint64_t)( ((uint64_t)M_ByteSwap32(M_DoubleWord0(q)) << 32) | (uint64_t)M_ByteSwap32(M_DoubleWord1(q)) ) )
+    #endif
+
     //define something called reserved that has a value of zero. Use it to set reserved bytes to 0
     #define RESERVED 0
     #define OBSOLETE 0
@@ -259,6 +275,224 @@ extern "C"
     #define  M_Min(a,b)    (((a)<(b))?(a):(b))
     #define  M_Max(a,b)    (((a)>(b))?(a):(b))
 
+    //MSVC doesn't understand the inline keyword when compiling C until VS2015, but it has always understood __inline
+    #if defined (_MSC_VER) && !defined (__cplusplus)
+        #define M_STATIC_INLINE static __inline
+    #else
+        #define M_STATIC_INLINE static inline
+    #endif
+
+    //Compile time check, for things like making sure a string table has an entry for every value of its enum. C99 has no _Static_assert, so this declares an array type with a negative size when the condition is false.
+    //Only use at file scope. The name must be unique in the file it is used in.
+    #define M_STATIC_ASSERT(condition, name) typedef char static_assert_##name[(condition) ? 1 : -1]
+
+    //Storage class for variables that each thread gets its own copy of. Every compiler we support had one of these long before C11's _Thread_local.
+    #if defined (_MSC_VER)
+        #define M_THREAD_LOCAL __declspec(thread)
+    #elif defined (__GNUC__) || defined (__clang__) || defined (__SUNPRO_C) || defined (__IBMC__)
+        #define M_THREAD_LOCAL __thread
+    #elif defined (__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined (__STDC_NO_THREADS__)
+        #define M_THREAD_LOCAL _Thread_local
+    #else
+        #define M_THREAD_LOCAL //unknown compiler. Shared between threads.
+    #endif
+
+    //Endianness of the system being compiled for, so that the preprocessor can pick byte swaps instead of checking at runtime.
+    //This checks more than get_Compiled_Endianness() since there is no runtime fallback here. Exactly one of OPENSEA_COMPILED_BIG_ENDIAN or OPENSEA_COMPILED_LITTLE_ENDIAN gets defined.
+    //If a compiler is not recognized, define one of these yourself when building. - TJE
+    #if defined (OPENSEA_COMPILED_BIG_ENDIAN) || defined (OPENSEA_COMPILED_LITTLE_ENDIAN)
+        //already set when building
+    #elif defined (__BYTE_ORDER__) && defined (__ORDER_BIG_ENDIAN__) && defined (__ORDER_LITTLE_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__ || __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+        #if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            #define OPENSEA_COMPILED_BIG_ENDIAN
+        #else
+            #define OPENSEA_COMPILED_LITTLE_ENDIAN
+        #endif
+    #elif defined (__BIG_ENDIAN__) || defined (__ARMEB__) || defined (__THUMBEB__) || defined (__AARCH64EB__) || defined (_MIPSEB) || defined (__MIPSEB) || defined (__MIPSEB__)
+        #define OPENSEA_COMPILED_BIG_ENDIAN
+    #elif defined (__LITTLE_ENDIAN__) || defined (__ARMEL__) || defined (__THUMBEL__) || defined (__AARCH64EL__) || defined (_MIPSEL) || defined (__MIPSEL) || defined (__MIPSEL__)
+        #define OPENSEA_COMPILED_LITTLE_ENDIAN
+    #elif defined (_WIN32) || defined (__i386) || defined (__i386__) || defined (_M_IX86) || defined (__x86_64) || defined (__x86_64__) || defined (__amd64) || defined (__amd64__) || defined (_M_X64) || defined (_M_AMD64) || defined (_M_ARM) || defined (_M_ARM64) || defined (__alpha__) || defined (__riscv)
+        //Windows is little endian on every architecture it runs on
+        #define OPENSEA_COMPILED_LITTLE_ENDIAN
+    #elif defined (__sparc) || defined (__sparc__) || defined (__hppa) || defined (__hppa__) || defined (_POWER) || defined (__powerpc__) || defined (__powerpc) || defined (__ppc__) || defined (__s390__) || defined (__s390x__) || defined (__m68k__)
+        //Sun Studio, HP aCC, and IBM XL do not define __BYTE_ORDER__. Little endian POWER compilers define __LITTLE_ENDIAN__, which was checked above.
+        #define OPENSEA_COMPILED_BIG_ENDIAN
+    #elif defined (_BIG_ENDIAN) && !defined (_LITTLE_ENDIAN)
+        //Solaris and AIX system headers
+        #define OPENSEA_COMPILED_BIG_ENDIAN
+    #elif defined (_LITTLE_ENDIAN) && !defined (_BIG_ENDIAN)
+        #define OPENSEA_COMPILED_LITTLE_ENDIAN
+    #else
+        #error "Unable to determine the endianness of the system being compiled for. Define OPENSEA_COMPILED_BIG_ENDIAN or OPENSEA_COMPILED_LITTLE_ENDIAN."
+    #endif
+
+    //-----------------------------------------------------------------------------
+    //
+    //  be16_Load(), be32_Load(), be64_Load(), le16_Load(), le32_Load(), le64_Load()
+    //  be16_Store(), be32_Store(), be64_Store(), le16_Store(), le32_Store(), le64_Store()
+    //
+    //! \brief   Description:  Read or write a big (be) or little (le) endian value from/to a data buffer (CDBs, log pages, identify data, etc).
+    //!                        The byte order is resolved when compiling so these compile down to a single load/store and a byte swap (or movbe) when one is needed.
+    //!                        The pointer does not need to be aligned.
+    //
+    //  Entry:
+    //!   \param[in] ptr = pointer to the first byte of the value in the buffer
+    //!   \param[in] value = (store only) the value to write to the buffer
+    //!
+    //  Exit:
+    //!   \return the value read from the buffer in the host's byte order (load only)
+    //
+    //-----------------------------------------------------------------------------
+    #if defined (OPENSEA_COMPILED_BIG_ENDIAN)
+        #define M_HostToBE16(w) ((uint16_t)(w))
+        #define M_HostToBE32(d) ((uint32_t)(d))
+        #define M_HostToBE64(q) ((uint64_t)(q))
+        #define M_HostToLE16(w) M_ByteSwap16(w)
+        #define M_HostToLE32(d) M_ByteSwap32(d)
+        #define M_HostToLE64(q) M_ByteSwap64(q)
+    #else
+        #define M_HostToBE16(w) M_ByteSwap16(w)
+        #define M_HostToBE32(d) M_ByteSwap32(d)
+        #define M_HostToBE64(q) M_ByteSwap64(q)
+        #define M_HostToLE16(w) ((uint16_t)(w))
+        #define M_HostToLE32(d) ((uint32_t)(d))
+        #define M_HostToLE64(q) ((uint64_t)(q))
+    #endif
+
+    M_STATIC_INLINE uint16_t be16_Load(const void *ptr)
+    {
+        uint16_t value;
+        memcpy(&value, ptr, sizeof(value));
+        return M_HostToBE16(value);
+    }
+
+    M_STATIC_INLINE uint32_t be32_Load(const void *ptr)
+    {
+        uint32_t value;
+        memcpy(&value, ptr, sizeof(value));
+        return M_HostToBE32(value);
+    }
+
+    M_STATIC_INLINE uint64_t be64_Load(const void *ptr)
+    {
+        uint64_t value;
+        memcpy(&value, ptr, sizeof(value));
+        return M_HostToBE64(value);
+    }
+
+    M_STATIC_INLINE uint16_t le16_Load(const void *ptr)
+    {
+        uint16_t value;
+        memcpy(&value, ptr, sizeof(value));
+        return M_HostToLE16(value);
+    }
+
+    M_STATIC_INLINE uint32_t le32_Load(const void *ptr)
+    {
+        uint32_t value;
+        memcpy(&value, ptr, sizeof(value));
+        return M_HostToLE32(value);
+    }
+
+    M_STATIC_INLINE uint64_t le64_Load(const void *ptr)
+    {
+        uint64_t value;
+        memcpy(&value, ptr, sizeof(value));
+        return M_HostToLE64(value);
+    }
+
+    M_STATIC_INLINE void be16_Store(void *ptr, uint16_t value)
+    {
+        value = M_HostToBE16(value);
+        memcpy(ptr, &value, sizeof(value));
+    }
+
+    M_STATIC_INLINE void be32_Store(void *ptr, uint32_t value)
+    {
+        value = M_HostToBE32(value);
+        memcpy(ptr, &value, sizeof(value));
+    }
+
+    M_STATIC_INLINE void be64_Store(void *ptr, uint64_t value)
+    {
+        value = M_HostToBE64(value);
+        memcpy(ptr, &value, sizeof(value));
+    }
+
+    M_STATIC_INLINE void le16_Store(void *ptr, uint16_t value)
+    {
+        value = M_HostToLE16(value);
+        memcpy(ptr, &value, sizeof(value));
+    }
+
+    M_STATIC_INLINE void le32_Store(void *ptr, uint32_t value)
+    {
+        value = M_HostToLE32(value);
+        memcpy(ptr, &value, sizeof(value));
+    }
+
+    M_STATIC_INLINE void le64_Store(void *ptr, uint64_t value)
+    {
+        value = M_HostToLE64(value);
+        memcpy(ptr, &value, sizeof(value));
+    }
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Bit_Range_Mask_64()
+    //
+    //! \brief   Description:  Creates a mask with bits msb through lsb set (inclusive). Works for the full 64bit range.
+    //
+    //  Entry:
+    //!   \param[in] msb = highest bit in the range (0 - 63). Must be greater than or equal to lsb.
+    //!   \param[in] lsb = lowest bit in the range (0 - 63)
+    //!
+    //  Exit:
+    //!   \return mask with the requested bits set
+    //
+    //-----------------------------------------------------------------------------
+    M_STATIC_INLINE uint64_t get_Bit_Range_Mask_64(uint8_t msb, uint8_t lsb)
+    {
+        return (UINT64_MAX >> (63 - (msb - lsb))) << lsb;
+    }
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Bit_Range_64(), get_Bit_Range_32(), get_Bit_Range_16(), get_Bit_Range_8()
+    //
+    //! \brief   Description:  Gets the value of bits msb through lsb (inclusive), shifted down so that lsb becomes bit 0.
+    //!                        Unlike M_GETBITRANGE, these work for every range in the input type, including the full width of the type.
+    //
+    //  Entry:
+    //!   \param[in] value = value to get the bit range from
+    //!   \param[in] msb = highest bit in the range. Must be greater than or equal to lsb and less than the width of the type
+    //!   \param[in] lsb = lowest bit in the range
+    //!
+    //  Exit:
+    //!   \return the value of the bit range
+    //
+    //-----------------------------------------------------------------------------
+    M_STATIC_INLINE uint64_t get_Bit_Range_64(uint64_t value, uint8_t msb, uint8_t lsb)
+    {
+        return (value >> lsb) & (UINT64_MAX >> (63 - (msb - lsb)));
+    }
+
+    M_STATIC_INLINE uint32_t get_Bit_Range_32(uint32_t value, uint8_t msb, uint8_t lsb)
+    {
+        return (value >> lsb) & (UINT32_MAX >> (31 - (msb - lsb)));
+    }
+
+    M_STATIC_INLINE uint16_t get_Bit_Range_16(uint16_t value, uint8_t msb, uint8_t lsb)
+    {
+        return (uint16_t)((value >> lsb) & (UINT16_MAX >> (15 - (msb - lsb))));
+    }
+
+    M_STATIC_INLINE uint8_t get_Bit_Range_8(uint8_t value, uint8_t msb, uint8_t lsb)
+    {
+        return (uint8_t)((value >> lsb) & (UINT8_MAX >> (7 - (msb - lsb))));
+    }
+
     typedef enum _eOutputFormat
     {
         SEAC_OUTPUT_TEXT, //default way everything is output
@@ -453,6 +687,112 @@ extern "C"
     //-----------------------------------------------------------------------------
     void double_Word_Swap_64(uint64_t *quadWordToSwap);
 
+    //-----------------------------------------------------------------------------
+    //
+    //  byte_Swap_16_Array()
+    //
+    //! \brief   Description:  swap the bytes in each word of an array. Uses SIMD instructions when they are available for the target being compiled for.
+    //
+    //  Entry:
+    //!   \param[out] wordArray = a pointer to the array of words to have the bytes swapped
+    //!   \param[in] count = number of words in the array (not the number of bytes)
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    void byte_Swap_16_Array(uint16_t *wordArray, size_t count);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  byte_Swap_32_Array()
+    //
+    //! \brief   Description:  swap the bytes in each double word of an array. Uses SIMD instructions when they are available for the target being compiled for.
+    //
+    //  Entry:
+    //!   \param[out] doubleWordArray = a pointer to the array of double words to have the bytes swapped
+    //!   \param[in] count = number of double words in the array (not the number of bytes)
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    void byte_Swap_32_Array(uint32_t *doubleWordArray, size_t count);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  byte_Swap_64_Array()
+    //
+    //! \brief   Description:  swap the bytes in each quad word of an array. Uses SIMD instructions when they are available for the target being compiled for.
+    //
+    //  Entry:
+    //!   \param[out] quadWordArray = a pointer to the array of quad words to have the bytes swapped
+    //!   \param[in] count = number of quad words in the array (not the number of bytes)
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    void byte_Swap_64_Array(uint64_t *quadWordArray, size_t count);
+
+    typedef enum _eFieldByteOrder
+    {
+        FIELD_LITTLE_ENDIAN, //ATA, NVMe
+        FIELD_BIG_ENDIAN     //SCSI
+    }eFieldByteOrder;
+
+    //Describes one field in a binary page (identify data, log page, mode page, etc) for decode_Fields()
+    typedef struct _fieldDescriptor
+    {
+        uint32_t offset;            //byte offset of the field in the buffer
+        uint8_t width;              //width of the field in bytes. Must be 1, 2, 4, or 8
+        eFieldByteOrder byteOrder;  //byte order of the field in the buffer. Ignored for 1 byte fields
+        uint8_t msb;                //highest bit of the value to keep. To keep the whole value, set this to (width * 8) - 1
+        uint8_t lsb;                //lowest bit of the value to keep. The value is shifted down so this bit becomes bit 0. To keep the whole value, set this to 0
+        uint64_t *destination;      //where to store the decoded value
+    }fieldDescriptor, *ptrFieldDescriptor;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  decode_Fields()
+    //
+    //! \brief   Description:  Decodes all the fields described in a table of field descriptors from a data buffer in a single pass.
+    //!                        Each field is read in the byte order given in its descriptor, then the requested bit range is pulled out and stored in the field's destination.
+    //!                        Listing the fields in order of increasing offset keeps the reads sequential through the buffer.
+    //
+    //  Entry:
+    //!   \param[in] dataBuffer = pointer to the data to decode fields from
+    //!   \param[in] dataLength = length of the data buffer in bytes
+    //!   \param[in] fields = pointer to the table of field descriptors
+    //!   \param[in] fieldCount = number of field descriptors in the table
+    //!
+    //  Exit:
+    //!   \return SUCCESS = all fields decoded, BAD_PARAMETER = a descriptor is invalid or reaches past the end of the buffer. Fields before the invalid one have already been decoded.
+    //
+    //-----------------------------------------------------------------------------
+    int decode_Fields(const uint8_t *dataBuffer, size_t dataLength, const fieldDescriptor *fields, size_t fieldCount);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Bit_Fields_64()
+    //
+    //! \brief   Description:  Unpacks several bit fields from a single 64bit value (status registers, feature bitfields, log parameter words, etc).
+    //!                        Each field is described by a mask of the bits that make it up. The bits selected by the mask are packed together starting at bit 0 of the output.
+    //!                        Masks do not need to be contiguous. Uses the BMI2 PEXT instruction when compiling for a CPU that has it.
+    //!                        Use get_Bit_Range_Mask_64() to create masks from msb/lsb values.
+    //
+    //  Entry:
+    //!   \param[in] value = value to unpack fields from
+    //!   \param[in] fieldMasks = array of masks, one for each field
+    //!   \param[out] fieldValues = array to store each field's value in. Must have room for fieldCount values
+    //!   \param[in] fieldCount = number of fields to unpack
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    void get_Bit_Fields_64(uint64_t value, const uint64_t *fieldMasks, uint64_t *fieldValues, size_t fieldCount);
+
     //-----------------------------------------------------------------------------
     //
     //  celsius_To_Fahrenheit()
@@ -558,6 +898,24 @@ extern "C"
     //-----------------------------------------------------------------------------
     void byte_Swap_String(char *stringToChange);
 
+    //-----------------------------------------------------------------------------
+    //
+    //  byte_Swap_And_Trim_ATA_String()
+    //
+    //! \brief   Description:  Converts an ATA string (model number, serial number, firmware revision) into a displayable string in place with a single pass over the data.
+    //!                        The bytes in each word are swapped, any non-printable characters are replaced with spaces, and leading and trailing spaces are removed.
+    //!                        No memory is allocated. The string does not need to be NULL terminated since the length is given.
+    //
+    //  Entry:
+    //!   \param[in,out] ataString = pointer to the ATA string to convert.
+    //!   \param[in] stringLength = length of the ATA string in bytes (ex: 40 for the model number)
+    //!
+    //  Exit:
+    //!   \return the length of the string after trimming. All bytes after the new length (up to stringLength) are set to zero, so the result is NULL terminated whenever it is shorter than stringLength.
+    //
+    //-----------------------------------------------------------------------------
+    size_t byte_Swap_And_Trim_ATA_String(char *ataString, size_t stringLength);
+
     //-----------------------------------------------------------------------------
     //
     //  remove_Whitespace_Left()
@@ -618,6 +976,27 @@ extern "C"
     //-----------------------------------------------------------------------------
     void remove_Leading_And_Trailing_Whitespace(char *stringToChange);
 
+    //-----------------------------------------------------------------------------
+    //
+    //  remove_Leading_Whitespace_Len(), remove_Trailing_Whitespace_Len(), remove_Leading_And_Trailing_Whitespace_Len()
+    //
+    //! \brief   Description:  Same as the functions above, but the length of the string is given instead of calculated, and the new length is returned.
+    //!                        Leading whitespace is space, \t, \n, \v, and \f. Trailing whitespace also includes \r (same as isspace() in the C locale). Only one pass is made over the string and at most one memmove is done.
+    //
+    //  Entry:
+    //!   \param[out] stringToChange = a pointer to the data containing a string that needs whitespace removed
+    //!   \param[in] stringLength = length of the string in bytes (not including a null terminator)
+    //!
+    //  Exit:
+    //!   \return the length of the string after whitespace is removed. If this is less than stringLength, a null terminator is written after the new end of the string.
+    //
+    //-----------------------------------------------------------------------------
+    size_t remove_Leading_Whitespace_Len(char *stringToChange, size_t stringLength);
+
+    size_t remove_Trailing_Whitespace_Len(char *stringToChange, size_t stringLength);
+
+    size_t remove_Leading_And_Trailing_Whitespace_Len(char *stringToChange, size_t stringLength);
+
     //-----------------------------------------------------------------------------
     //
     //  convert_String_To_Upper_Case()
@@ -650,333 +1029,1290 @@ extern "C"
 
     //-----------------------------------------------------------------------------
     //
-    //  print_Data_Buffer()
+    //  convert_String_To_Upper_Case_Len(), convert_String_To_Lower_Case_Len()
     //
-    //! \brief   Description:  print out a data buffer to the screen
+    //! \brief   Description:  convert a string of a known length to all uppercase or lowercase letters in place. Only ASCII letters are changed, so this does not depend on the current locale.
     //
     //  Entry:
-    //!   \param[in] dataBuffer = a pointer to the data buffer you want to print out
-    //!   \param[in] bufferLen = the length that you want to print out. This can be the length of the buffer, or anything less than that
-    //!   \param[in] showPrint = set to true to show printable characters on the side of the hex output for the buffer. Non-printable characters will be represented as dots.
+    //!   \param[out] stringToChange = a pointer to the data containing a string that needs to have its case converted
+    //!   \param[in] stringLength = number of characters to convert
     //!
     //  Exit:
     //!   \return VOID
     //
     //-----------------------------------------------------------------------------
-    void print_Data_Buffer(uint8_t *dataBuffer, uint32_t bufferLen, bool showPrint);
+    void convert_String_To_Upper_Case_Len(char *stringToChange, size_t stringLength);
+
+    void convert_String_To_Lower_Case_Len(char *stringToChange, size_t stringLength);
 
     //-----------------------------------------------------------------------------
     //
-    //  print_Return_Enum()
+    //  copy_String_To_Upper_Case(), copy_String_To_Lower_Case()
     //
-    //! \brief   Description:  Prints humanized eReturnValue for a given return value
+    //! \brief   Description:  copy a string to another buffer, converting it to all uppercase or lowercase letters on the way. Only ASCII letters are changed, so this does not depend on the current locale.
     //
     //  Entry:
-    //!   \param[in] funcName = Name of function value returning from.
-    //!   \param[in] ret = value to humanize
+    //!   \param[out] destination = buffer to copy to. Must hold at least stringLength + 1 bytes. A null terminator is added after the copied characters.
+    //!   \param[in] source = string to copy from
+    //!   \param[in] stringLength = number of characters to copy
     //!
     //  Exit:
     //!   \return VOID
     //
     //-----------------------------------------------------------------------------
-    void print_Return_Enum(char *funcName, int ret);
+    void copy_String_To_Upper_Case(char *destination, const char *source, size_t stringLength);
+
+    void copy_String_To_Lower_Case(char *destination, const char *source, size_t stringLength);
 
     //-----------------------------------------------------------------------------
     //
-    //  metric_Unit_Convert()
+    //  compare_String_Case_Insensitive()
     //
-    //! \brief   Description:  Takes a double value which is a a numberic value specifying a number of bytes, and 
-    //!                        converts it to KB, MB, GB, TB, etc in a more easy to display manor. Sets the units for you for display purposes too.
+    //! \brief   Description:  compare two buffers of characters ignoring the case of ASCII letters (similar to memcmp). Every byte up to length is compared, including null terminators,
+    //!                        so length must not be longer than either buffer. To compare null terminated strings, pass the length of the shorter string + 1.
     //
     //  Entry:
-    //!   \param[in] byteValue = value specifying a number of bytes
-    //!   \param[in] metricUnit = char ptr to hold the metric unit. This can be NULL
+    //!   \param[in] string1 = first string to compare
+    //!   \param[in] string2 = second string to compare
+    //!   \param[in] length = number of characters to compare
     //!
     //  Exit:
-    //!   \return SUCCESS on successful completion, !SUCCESS if problems encountered
+    //!   \return 0 if the strings match, < 0 if string1 sorts before string2, > 0 if string1 sorts after string2
     //
     //-----------------------------------------------------------------------------
-    int metric_Unit_Convert(double *byteValue, char** metricUnit);
+    int compare_String_Case_Insensitive(const char *string1, const char *string2, size_t length);
 
     //-----------------------------------------------------------------------------
     //
-    //  capacity_Unit_Convert()
+    //  print_Data_Buffer()
     //
-    //! \brief   Description:  Takes a double value which is a a numeric value specifying a number of bytes, and 
-    //!                        converts it to KiB, MiB, GiB, TiB, etc in a more easy to display manor. Sets the units for you for display purposes too.
+    //! \brief   Description:  print out a data buffer to the screen
     //
     //  Entry:
-    //!   \param[in] byteValue = value specifying a number of bytes
-    //!   \param[in] capacityUnit = char ptr to hold the metric unit. This can be NULL
+    //!   \param[in] dataBuffer = a pointer to the data buffer you want to print out
+    //!   \param[in] bufferLen = the length that you want to print out. This can be the length of the buffer, or anything less than that
+    //!   \param[in] showPrint = set to true to show printable characters on the side of the hex output for the buffer. Non-printable characters will be represented as dots.
     //!
     //  Exit:
-    //!   \return SUCCESS on successful completion, !SUCCESS if problems encountered
+    //!   \return VOID
     //
     //-----------------------------------------------------------------------------
-    int capacity_Unit_Convert(double *byteValue, char** capacityUnit);
+    void print_Data_Buffer(uint8_t *dataBuffer, uint32_t bufferLen, bool showPrint);
+
+    //Hex dumps are built a line at a time into a block and written out once per block instead of calling printf for every byte.
+    #define HEX_DUMP_BLOCK_SIZE 4096
+
+    typedef enum _eHexDumpOutputType
+    {
+        HEX_DUMP_OUTPUT_FILE,
+        HEX_DUMP_OUTPUT_FD,
+        HEX_DUMP_OUTPUT_BUFFER,
+    }eHexDumpOutputType;
+
+    //Internal state of where hex dump output is going. Use the hex_Dump_Stream_Init_* functions to set this up.
+    typedef struct _hexDumpWriter
+    {
+        eHexDumpOutputType outputType;
+        FILE *outputFile;
+        int outputFD;
+        char *outputBuffer;
+        size_t outputBufferSize;
+        uint64_t outputLength;//total number of characters produced, even those that did not fit in outputBuffer
+        bool outputError;
+        size_t blockLength;
+        char block[HEX_DUMP_BLOCK_SIZE];
+    }hexDumpWriter;
+
+    //use as the expected length of a hex dump stream when the total length is not known ahead of time
+    #define HEX_DUMP_LENGTH_UNKNOWN UINT64_MAX
 
     //-----------------------------------------------------------------------------
     //
-    //  safe_Free()
-    //
-    //! \brief   Description:  Safely free dynamically allocated memory. This checks for a valid pointer, then frees it and set's it to NULL.
+    //  hexDumpStream
     //
-    //  Entry:
-    //!   \param[in] mem - heap memory you want to free.
-    //!
-    //  Exit:
-    //!   \return void
+    //! \brief   Description:  Prints data in the print_Data_Buffer format as it arrives in chunks (for example, from consecutive reads) without needing the whole buffer at once.
+    //!                        Offsets continue from one chunk to the next and bytes that do not fill a whole line are held until the next chunk. Lengths over 4GiB are supported.
+    //!                        If the total length is given at init, the output is identical to print_Data_Buffer for the same data. Otherwise the offset column starts
+    //!                        at 2 digits and widens as the offset grows.
     //
     //-----------------------------------------------------------------------------
-    #define safe_Free(mem)  \
-    if(mem)                 \
-    {                       \
-        free(mem);          \
-        mem = NULL;         \
-    }                       \
+    typedef struct _hexDumpStream
+    {
+        hexDumpWriter writer;
+        uint64_t offset;            //offset of the next byte to be printed
+        uint64_t expectedLength;    //total length given at init, or HEX_DUMP_LENGTH_UNKNOWN
+        uint8_t offsetWidth;        //number of hex digits in the offset column
+        bool showPrint;
+        bool headerWritten;
+        uint8_t lineLength;         //number of bytes in line waiting for the rest of the line
+        uint8_t line[16];
+        bool collapseDuplicates;    //see hex_Dump_Stream_Set_Collapse_Duplicates
+        bool previousLineValid;
+        bool collapsing;            //set while skipping a run of lines that match previousLine
+        uint8_t previousLine[16];
+    }hexDumpStream;
 
     //-----------------------------------------------------------------------------
     //
-    //  convert_Seconds_To_Displayable_Time()
+    //  hex_Dump_Stream_Init_File(), hex_Dump_Stream_Init_FD(), hex_Dump_Stream_Init_Buffer()
     //
-    //! \brief   Description:  Takes a time in seconds and converts it to something more friendly to display. Any input NULL pointers will be skipped.
+    //! \brief   Description:  Set up a hex dump stream to write to a file, file descriptor, or a string buffer.
     //
     //  Entry:
-    //!   \param[in] secondsToConvert - a value specifying the number of seconds to convert
-    //!   \param[out] years = this is a pointer to a value to hold a number representing years. Can be NULL.
-    //!   \param[out] days = this is a pointer to a value to hold a number representing days. Can be NULL.
-    //!   \param[out] hours = this is a pointer to a value to hold a number representing hours. Can be NULL.
-    //!   \param[out] minutes = this is a pointer to a value to hold a number representing minutes. Can be NULL.
-    //!   \param[out] seconds = this is a pointer to a value to hold a number representing seconds. Can be NULL.
+    //!   \param[out] stream = pointer to the stream to set up. This is a few KiB, but is fine to keep on the stack.
+    //!   \param[in] outputFile/fileDescriptor = where to write the output to
+    //!   \param[out] outputBuffer = buffer to write the output to. The output is null terminated at hex_Dump_Stream_Finish and truncated if it does not fit.
+    //!   \param[in] outputBufferSize = size of outputBuffer in bytes
+    //!   \param[in] expectedLength = total number of bytes that will be written, used to size the offset column and header. HEX_DUMP_LENGTH_UNKNOWN if not known.
+    //!   \param[in] showPrint = set to true to show printable characters on the side of the hex output for the buffer. Non-printable characters will be represented as dots.
     //!
     //  Exit:
-    //!   \return void
+    //!   \return VOID
     //
     //-----------------------------------------------------------------------------
-    void convert_Seconds_To_Displayable_Time(uint64_t secondsToConvert, uint8_t *years, uint8_t *days, uint8_t *hours, uint8_t *minutes, uint8_t *seconds);
+    void hex_Dump_Stream_Init_File(hexDumpStream *stream, FILE *outputFile, uint64_t expectedLength, bool showPrint);
 
-	//-----------------------------------------------------------------------------
-	//
-	//  get_And_Validate_Integer_Input()
-	//
-	//! \brief   Description:	Validates an input as unsigned integer & converts it to unsigned type.
-	//!							This function supports hex values such as 0xFF AEh etc.  	
-	//
-	//  Entry:
-	//!   \param[in] strToConvert - const char * buffer to convert to integer
-	//!   \param[out] outputInteger - pointer to integer to store the output
-	//!
-	//  Exit:
-	//!   \return SUCCESS on successful completion, !SUCCESS if problems encountered
-	//
-	//-----------------------------------------------------------------------------
-	int get_And_Validate_Integer_Input(const char * strToConvert, uint64_t * outputInteger);
+    void hex_Dump_Stream_Init_FD(hexDumpStream *stream, int fileDescriptor, uint64_t expectedLength, bool showPrint);
+
+    void hex_Dump_Stream_Init_Buffer(hexDumpStream *stream, char *outputBuffer, size_t outputBufferSize, uint64_t expectedLength, bool showPrint);
 
     //-----------------------------------------------------------------------------
     //
-    //  print_Time_To_Screen()
+    //  hex_Dump_Stream_Set_Collapse_Duplicates()
     //
-    //! \brief   Description:  Takes a time represented by pointers and prints it to the screen in a friendly way. It will print a space before and after the time for you. If you do not wish to show one of the parameters, it may be null as it will be skipped. Values of zero are also skipped.
+    //! \brief   Description:  Turn on or off collapsing of duplicate lines (similar to hexdump -C). When on, a run of 16 byte lines that are the same as the line before them
+    //!                        is printed as a single "*" line. The last line of the data is always printed so the ending offset is shown. Off by default.
     //
     //  Entry:
-    //!   \param[in] years = this is a pointer to a value holding a number representing years. Can be NULL.
-    //!   \param[in] days = this is a pointer to a value holding a number representing days. Can be NULL.
-    //!   \param[in] hours = this is a pointer to a value holding a number representing hours. Can be NULL.
-    //!   \param[in] minutes = this is a pointer to a value holding a number representing minutes. Can be NULL.
-    //!   \param[in] seconds = this is a pointer to a value holding a number representing seconds. Can be NULL.
+    //!   \param[in] stream = pointer to the stream. Call before writing any data.
+    //!   \param[in] collapseDuplicates = true to collapse duplicate lines
     //!
     //  Exit:
-    //!   \return void
+    //!   \return VOID
     //
     //-----------------------------------------------------------------------------
-    void print_Time_To_Screen(uint8_t *years, uint8_t *days, uint8_t *hours, uint8_t *minutes, uint8_t *seconds);
+    void hex_Dump_Stream_Set_Collapse_Duplicates(hexDumpStream *stream, bool collapseDuplicates);
 
-    extern uint32_t seed32Array[2];
-    extern uint64_t seed64Array[2];
     //-----------------------------------------------------------------------------
     //
-    //  seed_32()
+    //  hex_Dump_Stream_Write()
     //
-    //! \brief   Description:  Takes a 32bit unsigned integer for the seed start and plugs it into the seed32Array in 0. 1 is filled with seed>>1, then the random number generator is run twice replacing each seed value in the array
+    //! \brief   Description:  Add the next chunk of data to a hex dump stream. Output is written a block at a time, so some of it may not be written until later calls or hex_Dump_Stream_Finish.
     //
     //  Entry:
-    //!   \param[in] seed = value to use as a seed for the random number generator
+    //!   \param[in] stream = pointer to the stream
+    //!   \param[in] data = next chunk of data to print
+    //!   \param[in] length = length of data in bytes
     //!
     //  Exit:
-    //!   \return void
+    //!   \return SUCCESS = no errors so far, FAILURE = an error occured writing the output, BAD_PARAMETER = invalid pointer
     //
     //-----------------------------------------------------------------------------
-    void seed_32(uint32_t seed);//start the seed for random number generation
+    int hex_Dump_Stream_Write(hexDumpStream *stream, const uint8_t *data, uint64_t length);
 
     //-----------------------------------------------------------------------------
     //
-    //  seed_64()
+    //  hex_Dump_Stream_Finish()
     //
-    //! \brief   Description:  Takes a 64bit unsigned integer for the seed start and plugs it into the seed64Array in 0. 1 is filled with seed>>2, then the random number generator is run twice replacing each seed value in the array
+    //! \brief   Description:  Print any partial line that is left over, end the dump and write out everything still held in the stream. For buffer output, stream->writer.outputLength is the full length of the output.
     //
     //  Entry:
-    //!   \param[in] seed = value to use as a seed for the random number generator
+    //!   \param[in] stream = pointer to the stream
     //!
     //  Exit:
-    //!   \return void
+    //!   \return SUCCESS = everything was written, FAILURE = an error occured writing the output, BAD_PARAMETER = invalid pointer
     //
     //-----------------------------------------------------------------------------
-    void seed_64(uint64_t seed);//start the seed for random number generation
+    int hex_Dump_Stream_Finish(hexDumpStream *stream);
 
     //-----------------------------------------------------------------------------
     //
-    //  xorshiftplus32()
+    //  print_Data_Buffer_Collapsed()
     //
-    //! \brief   Description:  Generate a 32bit (psuedo) random number using the xorshiftplus alorithm http://en.wikipedia.org/wiki/Xorshift. This was chosen for implemtnation for being fast and light weight
+    //! \brief   Description:  print out a data buffer to the screen the same as print_Data_Buffer, but runs of identical 16 byte lines are printed as a single "*" line.
     //
     //  Entry:
-    //!
+    //!   \param[in] dataBuffer = a pointer to the data buffer you want to print out
+    //!   \param[in] bufferLen = the length that you want to print out. This can be the length of the buffer, or anything less than that
+    //!   \param[in] showPrint = set to true to show printable characters on the side of the hex output for the buffer. Non-printable characters will be represented as dots.
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    void print_Data_Buffer_Collapsed(const uint8_t *dataBuffer, uint64_t bufferLen, bool showPrint);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  print_Data_Buffer_To_File(), print_Data_Buffer_To_FD()
+    //
+    //! \brief   Description:  print out a data buffer to a file or file descriptor. Output is the same as print_Data_Buffer, but is built a block at a time and written once per block.
+    //
+    //  Entry:
+    //!   \param[in] outputFile/fileDescriptor = where to write the output to. print_Data_Buffer uses stdout.
+    //!   \param[in] dataBuffer = a pointer to the data buffer you want to print out
+    //!   \param[in] bufferLen = the length that you want to print out. This can be the length of the buffer, or anything less than that
+    //!   \param[in] showPrint = set to true to show printable characters on the side of the hex output for the buffer. Non-printable characters will be represented as dots.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = everything was written, FAILURE = an error occured writing the output, BAD_PARAMETER = invalid pointer or file descriptor
+    //
+    //-----------------------------------------------------------------------------
+    int print_Data_Buffer_To_File(FILE *outputFile, const uint8_t *dataBuffer, uint64_t bufferLen, bool showPrint);
+
+    int print_Data_Buffer_To_FD(int fileDescriptor, const uint8_t *dataBuffer, uint64_t bufferLen, bool showPrint);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  format_Data_Buffer()
+    //
+    //! \brief   Description:  write the same output as print_Data_Buffer into a string instead of to the screen.
+    //
+    //  Entry:
+    //!   \param[out] outputBuffer = buffer to write the output to. The output is always null terminated and is truncated if it does not fit.
+    //!   \param[in] outputBufferSize = size of outputBuffer in bytes. May be 0 (with a NULL outputBuffer) to find out how large the buffer needs to be.
+    //!   \param[in] dataBuffer = a pointer to the data buffer you want to print out
+    //!   \param[in] bufferLen = the length that you want to print out. This can be the length of the buffer, or anything less than that
+    //!   \param[in] showPrint = set to true to show printable characters on the side of the hex output for the buffer. Non-printable characters will be represented as dots.
+    //!
+    //  Exit:
+    //!   \return length of the full output, not counting the null terminator. If this is >= outputBufferSize, the output was truncated.
+    //
+    //-----------------------------------------------------------------------------
+    uint64_t format_Data_Buffer(char *outputBuffer, size_t outputBufferSize, const uint8_t *dataBuffer, uint64_t bufferLen, bool showPrint);
+
+    typedef struct _dataBufferDiffSummary
+    {
+        uint64_t mismatchCount;         //number of bytes that are different
+        uint64_t mismatchLineCount;     //number of 16 byte lines with at least one difference
+        uint64_t firstMismatchOffset;   //only valid when mismatchCount is not 0
+        uint64_t lastMismatchOffset;    //only valid when mismatchCount is not 0
+    }dataBufferDiffSummary, *ptrDataBufferDiffSummary;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  print_Data_Buffer_Diff(), print_Data_Buffer_Diff_To_File(), print_Data_Buffer_Diff_To_FD()
+    //
+    //! \brief   Description:  compare two data buffers and print out only the 16 byte lines that are different. Each different line is printed as the bytes from buffer A (with the offset),
+    //!                        the bytes from buffer B, then a line marking the bytes that differ with ^^. A summary of the differences is printed at the end.
+    //
+    //  Entry:
+    //!   \param[in] outputFile/fileDescriptor = where to write the output to. print_Data_Buffer_Diff uses stdout.
+    //!   \param[in] bufferA = first buffer to compare (for example, the expected data)
+    //!   \param[in] bufferB = second buffer to compare (for example, the data that was read back)
+    //!   \param[in] bufferLen = number of bytes to compare. Both buffers must be at least this long.
+    //!   \param[out] summary = optional pointer to get the number of differences and the first and last offsets that differ. May be NULL.
+    //!
+    //  Exit:
+    //!   \return print_Data_Buffer_Diff_To_File/print_Data_Buffer_Diff_To_FD: SUCCESS = everything was written, FAILURE = an error occured writing the output, BAD_PARAMETER = invalid pointer or file descriptor
+    //
+    //-----------------------------------------------------------------------------
+    void print_Data_Buffer_Diff(const uint8_t *bufferA, const uint8_t *bufferB, uint64_t bufferLen, ptrDataBufferDiffSummary summary);
+
+    int print_Data_Buffer_Diff_To_File(FILE *outputFile, const uint8_t *bufferA, const uint8_t *bufferB, uint64_t bufferLen, ptrDataBufferDiffSummary summary);
+
+    int print_Data_Buffer_Diff_To_FD(int fileDescriptor, const uint8_t *bufferA, const uint8_t *bufferB, uint64_t bufferLen, ptrDataBufferDiffSummary summary);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  format_Data_Buffer_Diff()
+    //
+    //! \brief   Description:  write the same output as print_Data_Buffer_Diff into a string instead of to the screen.
+    //
+    //  Entry:
+    //!   \param[out] outputBuffer = buffer to write the output to. The output is always null terminated and is truncated if it does not fit.
+    //!   \param[in] outputBufferSize = size of outputBuffer in bytes. May be 0 (with a NULL outputBuffer) to find out how large the buffer needs to be.
+    //!   \param[in] bufferA = first buffer to compare (for example, the expected data)
+    //!   \param[in] bufferB = second buffer to compare (for example, the data that was read back)
+    //!   \param[in] bufferLen = number of bytes to compare. Both buffers must be at least this long.
+    //!   \param[out] summary = optional pointer to get the number of differences and the first and last offsets that differ. May be NULL.
+    //!
+    //  Exit:
+    //!   \return length of the full output, not counting the null terminator. If this is >= outputBufferSize, the output was truncated.
+    //
+    //-----------------------------------------------------------------------------
+    uint64_t format_Data_Buffer_Diff(char *outputBuffer, size_t outputBufferSize, const uint8_t *bufferA, const uint8_t *bufferB, uint64_t bufferLen, ptrDataBufferDiffSummary summary);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  parse_Data_Buffer_Dump()
+    //
+    //! \brief   Description:  read data back in from the output of print_Data_Buffer (or any of the other hex dump functions other than the diff dump) so it can be replayed.
+    //!                        The column header, offsets and printable character column are skipped. Offsets must be continuous, and "*" lines from collapsed dumps are
+    //!                        filled in with copies of the line before them up to the offset of the next line. Full lines are validated and converted 16 bytes at a time.
+    //
+    //  Entry:
+    //!   \param[in] dumpText = text of the dump
+    //!   \param[in] textLength = length of dumpText
+    //!   \param[out] dataBuffer = buffer to put the data in
+    //!   \param[in] dataBufferSize = size of dataBuffer in bytes
+    //!   \param[out] bytesParsed = optional pointer to get the number of bytes put in dataBuffer. When FAILURE is returned, this is the number of bytes before the problem.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = the whole dump was read, FAILURE = a line was not in the expected format, offsets were not continuous, or dataBuffer is too small, BAD_PARAMETER = invalid pointer
+    //
+    //-----------------------------------------------------------------------------
+    int parse_Data_Buffer_Dump(const char *dumpText, size_t textLength, uint8_t *dataBuffer, size_t dataBufferSize, size_t *bytesParsed);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  parse_Hex_String()
+    //
+    //! \brief   Description:  convert a string of hex digits to binary data. Each byte is 2 digits. An optional 0x at the start and whitespace between bytes are allowed (ex: "0xDEADBEEF" or "de ad be ef").
+    //!                        Runs of 32 digits are validated and converted 16 bytes at a time.
+    //
+    //  Entry:
+    //!   \param[in] hexString = string of hex digits
+    //!   \param[in] stringLength = length of hexString
+    //!   \param[out] dataBuffer = buffer to put the data in
+    //!   \param[in] dataBufferSize = size of dataBuffer in bytes
+    //!   \param[out] bytesParsed = optional pointer to get the number of bytes put in dataBuffer. When FAILURE is returned, this is the number of bytes before the problem.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = the whole string was converted, FAILURE = an invalid character or odd number of digits was found or dataBuffer is too small, BAD_PARAMETER = invalid pointer
+    //
+    //-----------------------------------------------------------------------------
+    int parse_Hex_String(const char *hexString, size_t stringLength, uint8_t *dataBuffer, size_t dataBufferSize, size_t *bytesParsed);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  print_Return_Enum()
+    //
+    //! \brief   Description:  Prints humanized eReturnValue for a given return value
+    //
+    //  Entry:
+    //!   \param[in] funcName = Name of function value returning from.
+    //!   \param[in] ret = value to humanize
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    void print_Return_Enum(char *funcName, int ret);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Return_Enum_String()
+    //
+    //! \brief   Description:  Gets the humanized name of an eReturnValue (same text as print_Return_Enum). The string is from a static table, so it is safe to use from any thread and must not be freed.
+    //
+    //  Entry:
+    //!   \param[in] ret = value to humanize
+    //!
+    //  Exit:
+    //!   \return pointer to a constant string naming the return value. "UNKNOWN" for values outside of eReturnValues.
+    //
+    //-----------------------------------------------------------------------------
+    const char* get_Return_Enum_String(int ret);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  metric_Unit_Convert()
+    //
+    //! \brief   Description:  Takes a double value which is a a numberic value specifying a number of bytes, and 
+    //!                        converts it to KB, MB, GB, TB, etc in a more easy to display manor. Sets the units for you for display purposes too.
+    //
+    //  Entry:
+    //!   \param[in] byteValue = value specifying a number of bytes
+    //!   \param[in] metricUnit = char ptr to hold the metric unit. This can be NULL
+    //!
+    //  Exit:
+    //!   \return SUCCESS on successful completion, !SUCCESS if problems encountered
+    //
+    //-----------------------------------------------------------------------------
+    int metric_Unit_Convert(double *byteValue, char** metricUnit);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  capacity_Unit_Convert()
+    //
+    //! \brief   Description:  Takes a double value which is a a numeric value specifying a number of bytes, and 
+    //!                        converts it to KiB, MiB, GiB, TiB, etc in a more easy to display manor. Sets the units for you for display purposes too.
+    //
+    //  Entry:
+    //!   \param[in] byteValue = value specifying a number of bytes
+    //!   \param[in] capacityUnit = char ptr to hold the metric unit. This can be NULL
+    //!
+    //  Exit:
+    //!   \return SUCCESS on successful completion, !SUCCESS if problems encountered
+    //
+    //-----------------------------------------------------------------------------
+    int capacity_Unit_Convert(double *byteValue, char** capacityUnit);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  format_Capacity_Metric(), format_Capacity_Binary()
+    //
+    //! \brief   Description:  Takes a number of bytes and writes it as an easy to display value with units, (ex: "2.00 TB" or "1.82 TiB") using only integer math.
+    //!                        format_Capacity_Metric uses powers of 1000 (KB, MB, GB...), format_Capacity_Binary uses powers of 1024 (KiB, MiB, GiB...). The last decimal place is rounded.
+    //
+    //  Entry:
+    //!   \param[in] byteValue = value specifying a number of bytes
+    //!   \param[in] decimalPlaces = number of digits to show after the decimal point. Up to 9 are supported. 0 shows no decimal point.
+    //!   \param[out] buffer = buffer to write the null terminated string to. 32 bytes is always large enough.
+    //!   \param[in] bufferSize = size of buffer in bytes
+    //!
+    //  Exit:
+    //!   \return length of the string written, not counting the null terminator. 0 if buffer is NULL or too small (nothing is written).
+    //
+    //-----------------------------------------------------------------------------
+    size_t format_Capacity_Metric(uint64_t byteValue, uint8_t decimalPlaces, char *buffer, size_t bufferSize);
+
+    size_t format_Capacity_Binary(uint64_t byteValue, uint8_t decimalPlaces, char *buffer, size_t bufferSize);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  format_Capacity_Array()
+    //
+    //! \brief   Description:  Formats a list of capacities the same as format_Capacity_Metric or format_Capacity_Binary, for example to fill a column of a report.
+    //
+    //  Entry:
+    //!   \param[in] byteValues = array of values specifying numbers of bytes
+    //!   \param[in] count = number of values in byteValues
+    //!   \param[in] metric = true for metric units (KB, MB...), false for binary units (KiB, MiB...)
+    //!   \param[in] decimalPlaces = number of digits to show after the decimal point
+    //!   \param[out] outputStrings = count strings of stringSize bytes each, one after the other. Strings that do not fit are set to empty.
+    //!   \param[in] stringSize = size of each string in outputStrings
+    //!
+    //  Exit:
+    //!   \return number of values that were formatted
+    //
+    //-----------------------------------------------------------------------------
+    size_t format_Capacity_Array(const uint64_t *byteValues, size_t count, bool metric, uint8_t decimalPlaces, char *outputStrings, size_t stringSize);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  safe_Free()
+    //
+    //! \brief   Description:  Safely free dynamically allocated memory. This checks for a valid pointer, then frees it and set's it to NULL.
+    //
+    //  Entry:
+    //!   \param[in] mem - heap memory you want to free.
+    //!
+    //  Exit:
+    //!   \return void
+    //
+    //-----------------------------------------------------------------------------
+    #define safe_Free(mem)  \
+    if(mem)                 \
+    {                       \
+        free(mem);          \
+        mem = NULL;         \
+    }                       \
+
+    //-----------------------------------------------------------------------------
+    //
+    //  convert_Seconds_To_Displayable_Time()
+    //
+    //! \brief   Description:  Takes a time in seconds and converts it to something more friendly to display. Any input NULL pointers will be skipped.
+    //!                        Years and days do not always fit in a uint8_t, so each is clamped to 255 when it is larger. Days are 0 - 364, so this happens for any duration with more than 255 days past the last whole year (ex: 300 days), not only for long durations like power on hours.
+    //!                        A clamped value is wrong, but looks plausible, and nothing tells the caller that it was clamped. Callers that may see durations this large should use format_Duration (for output) or convert_Seconds_To_Displayable_Time_64, which keep the full 64bit value.
+    //
+    //  Entry:
+    //!   \param[in] secondsToConvert - a value specifying the number of seconds to convert
+    //!   \param[out] years = this is a pointer to a value to hold a number representing years. Can be NULL.
+    //!   \param[out] days = this is a pointer to a value to hold a number representing days. Can be NULL.
+    //!   \param[out] hours = this is a pointer to a value to hold a number representing hours. Can be NULL.
+    //!   \param[out] minutes = this is a pointer to a value to hold a number representing minutes. Can be NULL.
+    //!   \param[out] seconds = this is a pointer to a value to hold a number representing seconds. Can be NULL.
+    //!
+    //  Exit:
+    //!   \return void
+    //
+    //-----------------------------------------------------------------------------
+    void convert_Seconds_To_Displayable_Time(uint64_t secondsToConvert, uint8_t *years, uint8_t *days, uint8_t *hours, uint8_t *minutes, uint8_t *seconds);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  convert_Seconds_To_Displayable_Time_64()
+    //
+    //! \brief   Description:  Same as convert_Seconds_To_Displayable_Time, but years and days are wide enough to hold any 64bit number of seconds. Any input NULL pointers will be skipped.
+    //
+    //  Entry:
+    //!   \param[in] secondsToConvert - a value specifying the number of seconds to convert
+    //!   \param[out] years = this is a pointer to a value to hold a number representing years. Can be NULL.
+    //!   \param[out] days = this is a pointer to a value to hold a number representing days (0 - 364). Can be NULL.
+    //!   \param[out] hours = this is a pointer to a value to hold a number representing hours. Can be NULL.
+    //!   \param[out] minutes = this is a pointer to a value to hold a number representing minutes. Can be NULL.
+    //!   \param[out] seconds = this is a pointer to a value to hold a number representing seconds. Can be NULL.
+    //!
+    //  Exit:
+    //!   \return void
+    //
+    //-----------------------------------------------------------------------------
+    void convert_Seconds_To_Displayable_Time_64(uint64_t secondsToConvert, uint64_t *years, uint16_t *days, uint8_t *hours, uint8_t *minutes, uint8_t *seconds);
+
+	//-----------------------------------------------------------------------------
+	//
+	//  get_And_Validate_Integer_Input()
+	//
+	//! \brief   Description:	Validates an input as unsigned integer & converts it to unsigned type.
+	//!							This function supports hex values such as 0xFF AEh etc.  	
+	//
+	//  Entry:
+	//!   \param[in] strToConvert - const char * buffer to convert to integer
+	//!   \param[out] outputInteger - pointer to integer to store the output
+	//!
+	//  Exit:
+	//!   \return SUCCESS on successful completion, !SUCCESS if problems encountered
+	//
+	//-----------------------------------------------------------------------------
+	int get_And_Validate_Integer_Input(const char * strToConvert, uint64_t * outputInteger);
+
+    typedef enum _eIntegerParseResult
+    {
+        INTEGER_PARSE_SUCCESS,
+        INTEGER_PARSE_EMPTY,                //string was NULL, empty, or only a prefix/suffix with no digits
+        INTEGER_PARSE_INVALID_CHARACTER,    //a character that is not part of a decimal or hex number was found
+        INTEGER_PARSE_OVERFLOW,             //the value does not fit in 64 bits
+        INTEGER_PARSE_BAD_PARAMETER,        //output pointer was NULL
+    }eIntegerParseResult;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  parse_Unsigned_Integer()
+    //
+    //! \brief   Description:  Converts a string to an unsigned 64bit integer in a single pass over the string.
+    //!                        Accepts decimal (1234), hex with a 0x prefix (0xFF), hex with an h suffix (AEh) and, for compatibility with get_And_Validate_Integer_Input,
+    //!                        hex with no prefix or suffix when it contains a digit A-F (AE). The full range of uint64_t is supported. Whitespace is not allowed.
+    //
+    //  Entry:
+    //!   \param[in] strToConvert = null terminated string to convert
+    //!   \param[out] outputInteger = pointer to integer to store the output. Only set when INTEGER_PARSE_SUCCESS is returned.
+    //!
+    //  Exit:
+    //!   \return INTEGER_PARSE_SUCCESS on success, otherwise one of the eIntegerParseResult values describing why the string could not be converted
+    //
+    //-----------------------------------------------------------------------------
+    eIntegerParseResult parse_Unsigned_Integer(const char *strToConvert, uint64_t *outputInteger);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  parse_Unsigned_Integer_Array()
+    //
+    //! \brief   Description:  Converts a list of strings to unsigned 64bit integers using the same rules as parse_Unsigned_Integer.
+    //
+    //  Entry:
+    //!   \param[in] stringsToConvert = array of null terminated strings to convert
+    //!   \param[in] count = number of strings in the array
+    //!   \param[out] outputIntegers = array of count integers to store the output. Entries for strings that fail to convert are set to 0.
+    //!   \param[out] results = array of count results, one for each string. May be NULL if only the count of successful conversions is needed.
+    //!
+    //  Exit:
+    //!   \return number of strings that were successfully converted
+    //
+    //-----------------------------------------------------------------------------
+    size_t parse_Unsigned_Integer_Array(const char * const *stringsToConvert, size_t count, uint64_t *outputIntegers, eIntegerParseResult *results);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  print_Time_To_Screen()
+    //
+    //! \brief   Description:  Takes a time represented by pointers and prints it to the screen in a friendly way. It will print a space before and after the time for you. If you do not wish to show one of the parameters, it may be null as it will be skipped. Values of zero are also skipped.
+    //
+    //  Entry:
+    //!   \param[in] years = this is a pointer to a value holding a number representing years. Can be NULL.
+    //!   \param[in] days = this is a pointer to a value holding a number representing days. Can be NULL.
+    //!   \param[in] hours = this is a pointer to a value holding a number representing hours. Can be NULL.
+    //!   \param[in] minutes = this is a pointer to a value holding a number representing minutes. Can be NULL.
+    //!   \param[in] seconds = this is a pointer to a value holding a number representing seconds. Can be NULL.
+    //!
+    //  Exit:
+    //!   \return void
+    //
+    //-----------------------------------------------------------------------------
+    void print_Time_To_Screen(uint8_t *years, uint8_t *days, uint8_t *hours, uint8_t *minutes, uint8_t *seconds);
+
+    //" 584942417355 years 364 days 23 hours 59 minutes 59 seconds " is the longest possible duration string. This leaves room for it and the null terminator.
+    #define DURATION_STRING_LENGTH 64
+
+    //-----------------------------------------------------------------------------
+    //
+    //  format_Duration()
+    //
+    //! \brief   Description:  Writes a number of seconds as " N years N days N hours N minutes N seconds " to a buffer in a single call. This is the same text print_Time_To_Screen prints, with zero values skipped and a space before and after.
+    //!                        Useful for building up output (power on time, estimated completion time, etc) without writing to the console one piece at a time.
+    //
+    //  Entry:
+    //!   \param[in] secondsToFormat = duration in seconds
+    //!   \param[out] buffer = buffer to write the null terminated string to. DURATION_STRING_LENGTH is always large enough.
+    //!   \param[in] bufferSize = size of buffer in bytes
+    //!
+    //  Exit:
+    //!   \return length of the string written, not counting the null terminator. 0 if buffer is NULL or too small (nothing is written).
+    //
+    //-----------------------------------------------------------------------------
+    size_t format_Duration(uint64_t secondsToFormat, char *buffer, size_t bufferSize);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  format_Duration_Array()
+    //
+    //! \brief   Description:  Format a list of durations with format_Duration. Useful for filling in a column of a report for many devices at once.
+    //
+    //  Entry:
+    //!   \param[in] secondsToFormat = array of durations in seconds
+    //!   \param[in] count = number of durations in the array
+    //!   \param[out] outputStrings = count strings of stringSize bytes each, back to back (ex: char outputStrings[count][DURATION_STRING_LENGTH]). A string that does not fit is left empty.
+    //!   \param[in] stringSize = size of each output string in bytes
+    //!
+    //  Exit:
+    //!   \return number of durations that were formatted
+    //
+    //-----------------------------------------------------------------------------
+    size_t format_Duration_Array(const uint64_t *secondsToFormat, size_t count, char *outputStrings, size_t stringSize);
+
+    //Default generator state used by seed_32/seed_64, xorshiftplus32/xorshiftplus64, random_Range_32/random_Range_64 and fill_Random_Pattern_In_Buffer.
+    //Each thread has its own copy, so threads do not race, but every thread starts from the same default seed. Use the _r versions with a generator state of your own for reproducible output.
+    extern M_THREAD_LOCAL uint32_t seed32Array[2];
+    extern M_THREAD_LOCAL uint64_t seed64Array[2];
+
+    //Generator state for the _r (reentrant) random number functions. Seed with seed_32_r/seed_64_r before use. Each state produces the same sequence as the matching non _r function would after the same seed.
+    typedef struct _xorshiftplus32State
+    {
+        uint32_t seed[2];
+    }xorshiftplus32State, *ptrXorshiftplus32State;
+
+    typedef struct _xorshiftplus64State
+    {
+        uint64_t seed[2];
+    }xorshiftplus64State, *ptrXorshiftplus64State;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  seed_32()
+    //
+    //! \brief   Description:  Takes a 32bit unsigned integer for the seed start and plugs it into the seed32Array in 0. 1 is filled with seed>>1, then the random number generator is run twice replacing each seed value in the array
+    //
+    //  Entry:
+    //!   \param[in] seed = value to use as a seed for the random number generator
+    //!
+    //  Exit:
+    //!   \return void
+    //
+    //-----------------------------------------------------------------------------
+    void seed_32(uint32_t seed);//start the seed for random number generation
+
+    //-----------------------------------------------------------------------------
+    //
+    //  seed_64()
+    //
+    //! \brief   Description:  Takes a 64bit unsigned integer for the seed start and plugs it into the seed64Array in 0. 1 is filled with seed>>2, then the random number generator is run twice replacing each seed value in the array
+    //
+    //  Entry:
+    //!   \param[in] seed = value to use as a seed for the random number generator
+    //!
+    //  Exit:
+    //!   \return void
+    //
+    //-----------------------------------------------------------------------------
+    void seed_64(uint64_t seed);//start the seed for random number generation
+
+    //-----------------------------------------------------------------------------
+    //
+    //  seed_32_r(), seed_64_r()
+    //
+    //! \brief   Description:  Same as seed_32/seed_64, but the seed is stored in the provided generator state instead of the thread's seed32Array/seed64Array.
+    //
+    //  Entry:
+    //!   \param[out] state = generator state to seed
+    //!   \param[in] seed = value to use as a seed for the random number generator
+    //!
+    //  Exit:
+    //!   \return void
+    //
+    //-----------------------------------------------------------------------------
+    void seed_32_r(xorshiftplus32State *state, uint32_t seed);
+
+    void seed_64_r(xorshiftplus64State *state, uint64_t seed);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  xorshiftplus32()
+    //
+    //! \brief   Description:  Generate a 32bit (psuedo) random number using the xorshiftplus alorithm http://en.wikipedia.org/wiki/Xorshift. This was chosen for implemtnation for being fast and light weight
+    //
+    //  Entry:
+    //!
+    //  Exit:
+    //!   \return random number
+    //
+    //-----------------------------------------------------------------------------
+    uint32_t xorshiftplus32(void);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  xorshiftplus64()
+    //
+    //! \brief   Description:  Generate a 64bit (psuedo) random number using the xorshiftplus alorithm http://en.wikipedia.org/wiki/Xorshift. This was chosen for implemtnation for being fast and light weight
+    //
+    //  Entry:
+    //!
+    //  Exit:
+    //!   \return random number
+    //
+    //-----------------------------------------------------------------------------
+    uint64_t xorshiftplus64(void);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  xorshiftplus32_r(), xorshiftplus64_r()
+    //
+    //! \brief   Description:  Same as xorshiftplus32/xorshiftplus64, using and updating the provided generator state. Safe to use from many threads at once as long as each thread has its own state.
+    //
+    //  Entry:
+    //!   \param[in,out] state = generator state. Must not be NULL.
+    //!
+    //  Exit:
+    //!   \return random number
+    //
+    //-----------------------------------------------------------------------------
+    uint32_t xorshiftplus32_r(xorshiftplus32State *state);
+
+    uint64_t xorshiftplus64_r(xorshiftplus64State *state);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  random_Range_32()
+    //
+    //! \brief   Description:  Generate a 32bit (psuedo) random number using the xorshiftplus alorithm within the specified range (slightly biased)
+    //
+    //  Entry:
+    //!   \param[in] rangeMin = value to use for minimum value of range
+    //!   \param[in] rangeMax = value to use for maximum value of range
+    //!
+    //  Exit:
+    //!   \return random number
+    //
+    //-----------------------------------------------------------------------------
+    uint32_t random_Range_32(uint32_t rangeMin, uint32_t rangeMax);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  random_Range_64()
+    //
+    //! \brief   Description:  Generate a 64bit (psuedo) random number using the xorshiftplus alorithm within the specified range (slightly biased)
+    //
+    //  Entry:
+    //!   \param[in] rangeMin = value to use for minimum value of range
+    //!   \param[in] rangeMax = value to use for maximum value of range
+    //!
+    //  Exit:
+    //!   \return random number
+    //
+    //-----------------------------------------------------------------------------
+    uint64_t random_Range_64(uint64_t rangeMin, uint64_t rangeMax);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  random_Range_32_r(), random_Range_64_r()
+    //
+    //! \brief   Description:  Same as random_Range_32/random_Range_64, using and updating the provided generator state.
+    //
+    //  Entry:
+    //!   \param[in,out] state = generator state. Must not be NULL.
+    //!   \param[in] rangeMin = value to use for minimum value of range
+    //!   \param[in] rangeMax = value to use for maximum value of range
+    //!
+    //  Exit:
+    //!   \return random number
+    //
+    //-----------------------------------------------------------------------------
+    uint32_t random_Range_32_r(xorshiftplus32State *state, uint32_t rangeMin, uint32_t rangeMax);
+
+    uint64_t random_Range_64_r(xorshiftplus64State *state, uint64_t rangeMin, uint64_t rangeMax);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  fill_Random_Pattern_In_Buffer(uint8_t *ptrData, uint32_t dataLength)
+    //
+    //! \brief   Description:  Fills a buffer with random data from a per thread xoshiro128x4 generator that is seeded from the clock the first time it is used. Every byte is filled, including any that do not make a full 32bit word.
+    //!                        Each call continues where the last left off, so buffers filled back to back are always different. Use fill_Random_Pattern_In_Buffer_Xoshiro128x4 with an explicit seed for reproducible data.
+    //
+    //  Entry:
+    //!   \param[out] ptrData = pointer to the data buffer to fill
+    //!   \param[in] dataLength = size of the data buffer in bytes
+    //!
+    //  Exit:
+    //!   \return SUCCESS = successfully filled buffer. BAD_PARAMETER = error in function parameters
+    //
+    //-----------------------------------------------------------------------------
+    int fill_Random_Pattern_In_Buffer(uint8_t *ptrData, uint32_t dataLength);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  fill_Random_Pattern_In_Buffer_r(xorshiftplus32State *state, uint8_t *ptrData, uint32_t dataLength)
+    //
+    //! \brief   Description:  Fills a buffer with random data from the provided generator state. Unlike fill_Random_Pattern_In_Buffer, the state is not reseeded from the time,
+    //!                        so the same seed always produces the same data and consecutive calls continue the same sequence. Data length must be at least sizeof(uint32_t) in size (4 bytes)
+    //
+    //  Entry:
+    //!   \param[in,out] state = generator state to use
+    //!   \param[out] ptrData = pointer to the data buffer to fill
+    //!   \param[in] dataLength = size of the data buffer in bytes (must be at least 4 bytes in size)
+    //!
+    //  Exit:
+    //!   \return SUCCESS = successfully filled buffer. BAD_PARAMETER = error in function parameters
+    //
+    //-----------------------------------------------------------------------------
+    int fill_Random_Pattern_In_Buffer_r(xorshiftplus32State *state, uint8_t *ptrData, uint32_t dataLength);
+
+    //Number of independent generators (lanes) in a xoshiro128x4State, and the number of bytes they produce per step together
+    #define XOSHIRO128X4_LANES 4
+    #define XOSHIRO128X4_BLOCK_SIZE (XOSHIRO128X4_LANES * sizeof(uint32_t))
+
+    //State for 4 interleaved xoshiro128++ generators. These are stepped together in a single SSE2/NEON register (or one after another on other systems, with identical output).
+    //s[n][lane] is word n of each lane's state so each row can be loaded straight into a vector register. Seed with seed_Xoshiro128x4 before use.
+    typedef struct _xoshiro128x4State
+    {
+        uint32_t s[4][XOSHIRO128X4_LANES];
+    }xoshiro128x4State, *ptrXoshiro128x4State;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  seed_Xoshiro128x4()
+    //
+    //! \brief   Description:  Seed all lanes of a xoshiro128x4 generator from a single 64bit seed. The seed is expanded with SplitMix64 so that similar seeds (0, 1, 2...) still give unrelated lanes and unrelated output.
+    //
+    //  Entry:
+    //!   \param[out] state = generator state to seed
+    //!   \param[in] seed = value to use as a seed for the random number generator
+    //!
+    //  Exit:
+    //!   \return void
+    //
+    //-----------------------------------------------------------------------------
+    void seed_Xoshiro128x4(xoshiro128x4State *state, uint64_t seed);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  xoshiro128x4_Next()
+    //
+    //! \brief   Description:  Step all lanes of the generator once, writing each lane's 32bit result as little endian (lane 0 first) to output.
+    //
+    //  Entry:
+    //!   \param[in,out] state = generator state. Must not be NULL.
+    //!   \param[out] output = XOSHIRO128X4_BLOCK_SIZE bytes to hold the random data
+    //!
+    //  Exit:
+    //!   \return void
+    //
+    //-----------------------------------------------------------------------------
+    void xoshiro128x4_Next(xoshiro128x4State *state, uint8_t output[XOSHIRO128X4_BLOCK_SIZE]);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  fill_Random_Pattern_In_Buffer_Xoshiro128x4(xoshiro128x4State *state, uint8_t *ptrData, uint64_t dataLength)
+    //
+    //! \brief   Description:  Fills a buffer with random data from the provided generator, XOSHIRO128X4_BLOCK_SIZE bytes per step. The same seed always produces the same data on every system.
+    //!                        If dataLength is not a multiple of XOSHIRO128X4_BLOCK_SIZE, the last step is only partly used and the next call starts with a new step.
+    //
+    //  Entry:
+    //!   \param[in,out] state = generator state to use
+    //!   \param[out] ptrData = pointer to the data buffer to fill
+    //!   \param[in] dataLength = size of the data buffer in bytes
+    //!
+    //  Exit:
+    //!   \return SUCCESS = successfully filled buffer. BAD_PARAMETER = error in function parameters
+    //
+    //-----------------------------------------------------------------------------
+    int fill_Random_Pattern_In_Buffer_Xoshiro128x4(xoshiro128x4State *state, uint8_t *ptrData, uint64_t dataLength);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  fill_Hex_Pattern_In_Buffer(uint32_t hexPattern, uint8_t *ptrData, uint32_t dataLength)
+    //
+    //! \brief   Description:  Fills a buffer with a hexadecimal pattern. The pattern is 32bits in length.
+    //
+    //  Entry:
+    //!   \param[in] hexPattern = 32bit hexadecimal pattern to put into buffer.
+    //!   \param[out] ptrData = pointer to the data buffer to fill
+    //!   \param[in] dataLength = size of the data buffer in bytes (must be at least 4 bytes in size)
+    //!
+    //  Exit:
+    //!   \return SUCCESS = successfully filled buffer. BAD_PARAMETER = error in function parameters
+    //
+    //-----------------------------------------------------------------------------
+    int fill_Hex_Pattern_In_Buffer(uint32_t hexPattern, uint8_t *ptrData, uint32_t dataLength);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  fill_Incrementing_Pattern_In_Buffer(uint8_t incrementStartValue, uint8_t *ptrData, uint32_t dataLength)
+    //
+    //! \brief   Description:  Fills a buffer with a incrementing pattern from a starting point
+    //
+    //  Entry:
+    //!   \param[in] incrementStartValue = value to start incrementing from.
+    //!   \param[out] ptrData = pointer to the data buffer to fill
+    //!   \param[in] dataLength = size of the data buffer in bytes.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = successfully filled buffer. BAD_PARAMETER = error in function parameters
+    //
+    //-----------------------------------------------------------------------------
+    int fill_Incrementing_Pattern_In_Buffer(uint8_t incrementStartValue, uint8_t *ptrData, uint32_t dataLength);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  fill_ASCII_Pattern_In_Buffer(const char *asciiPattern, uint32_t patternLength, uint8_t *ptrData, uint32_t dataLength)
+    //
+    //! \brief   Description:  Fills a buffer with an ASCII pattern (string).
+    //
+    //  Entry:
+    //!   \param[in] asciiPattern = pointer to ASCII pattern (string)
+    //!   \param[in] patternLength = length of the ASCII pattern
+    //!   \param[out] ptrData = pointer to the data buffer to fill
+    //!   \param[in] dataLength = size of the data buffer in bytes.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = successfully filled buffer. BAD_PARAMETER = error in function parameters
+    //
+    //-----------------------------------------------------------------------------
+    int fill_ASCII_Pattern_In_Buffer(const char *asciiPattern, uint32_t patternLength, uint8_t *ptrData, uint32_t dataLength);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  fill_Pattern_Buffer_Into_Another_Buffer(uint8_t *inPattern, uint32_t inpatternLength, uint8_t *ptrData, uint32_t dataLength)
+    //
+    //! \brief   Description:  Fills a buffer from a pattern memory buffer and will repeat the pattern to fill the out buffer. (i.e., 1 sector in gets copied and put into all 4 sectors out)
+    //
+    //  Entry:
+    //!   \param[in] inPattern = pointer to a uint8 buffer
+    //!   \param[in] inpatternLength = length of the incomming pattern
+    //!   \param[out] ptrData = pointer to the data buffer to fill
+    //!   \param[in] dataLength = size of the data buffer in bytes.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = successfully filled buffer. BAD_PARAMETER = error in function parameters
+    //
+    //-----------------------------------------------------------------------------
+    int fill_Pattern_Buffer_Into_Another_Buffer(uint8_t *inPattern, uint32_t inpatternLength, uint8_t *ptrData, uint32_t dataLength);
+
+    //The _Parallel fill functions split the buffer into slices of this size. Each slice's contents only depend on its offset in the buffer, so the output is the same no matter how many threads are used.
+    #define PARALLEL_FILL_SLICE_SIZE UINT64_C(1048576)
+    #define PARALLEL_FILL_MAX_THREADS 64
+
+    //-----------------------------------------------------------------------------
+    //
+    //  fill_Random_Pattern_In_Buffer_Parallel(uint64_t seed, uint8_t *ptrData, uint64_t dataLength, uint32_t threadCount)
+    //
+    //! \brief   Description:  Fills a (large) buffer with random data using multiple threads. Each PARALLEL_FILL_SLICE_SIZE slice is filled by its own xoshiro128x4 generator with a seed derived from seed and the slice number,
+    //!                        so the same seed always produces byte for byte the same buffer for any threadCount, including 1. The first slice matches fill_Random_Pattern_In_Buffer_Xoshiro128x4 after seed_Xoshiro128x4(seed).
+    //
+    //  Entry:
+    //!   \param[in] seed = value to derive each slice's seed from
+    //!   \param[out] ptrData = pointer to the data buffer to fill
+    //!   \param[in] dataLength = size of the data buffer in bytes
+    //!   \param[in] threadCount = number of threads to use (including the calling thread). 0 uses one per online processor. At most PARALLEL_FILL_MAX_THREADS are used.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = successfully filled buffer. BAD_PARAMETER = error in function parameters
+    //
+    //-----------------------------------------------------------------------------
+    int fill_Random_Pattern_In_Buffer_Parallel(uint64_t seed, uint8_t *ptrData, uint64_t dataLength, uint32_t threadCount);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  fill_Hex_Pattern_In_Buffer_Parallel(), fill_Incrementing_Pattern_In_Buffer_Parallel(), fill_ASCII_Pattern_In_Buffer_Parallel()
+    //
+    //! \brief   Description:  Multithreaded versions of fill_Hex_Pattern_In_Buffer, fill_Incrementing_Pattern_In_Buffer and fill_ASCII_Pattern_In_Buffer for buffers larger than 4GiB or where one core cannot keep up.
+    //!                        The data written is the same as the single threaded versions. Like fill_Hex_Pattern_In_Buffer, the hex pattern only fills whole 32bit words and leaves any trailing bytes untouched.
+    //
+    //  Entry:
+    //!   \param[in] hexPattern = 32bit hexadecimal pattern to put into buffer.
+    //!   \param[in] incrementStartValue = value of the first byte. Each following byte is one more, wrapping from 255 to 0.
+    //!   \param[in] asciiPattern = pattern to repeat in the buffer
+    //!   \param[in] patternLength = length of asciiPattern in bytes
+    //!   \param[out] ptrData = pointer to the data buffer to fill
+    //!   \param[in] dataLength = size of the data buffer in bytes
+    //!   \param[in] threadCount = number of threads to use (including the calling thread). 0 uses one per online processor. At most PARALLEL_FILL_MAX_THREADS are used.
+    //!
     //  Exit:
-    //!   \return random number
+    //!   \return SUCCESS = successfully filled buffer. BAD_PARAMETER = error in function parameters (including a hex pattern buffer smaller than 4 bytes)
     //
     //-----------------------------------------------------------------------------
-    uint32_t xorshiftplus32(void);
+    int fill_Hex_Pattern_In_Buffer_Parallel(uint32_t hexPattern, uint8_t *ptrData, uint64_t dataLength, uint32_t threadCount);
+
+    int fill_Incrementing_Pattern_In_Buffer_Parallel(uint8_t incrementStartValue, uint8_t *ptrData, uint64_t dataLength, uint32_t threadCount);
+
+    int fill_ASCII_Pattern_In_Buffer_Parallel(const char *asciiPattern, uint32_t patternLength, uint8_t *ptrData, uint64_t dataLength, uint32_t threadCount);
 
     //-----------------------------------------------------------------------------
     //
-    //  xorshiftplus64()
+    //  fill_Random_Pattern_At_Offset(uint64_t seed, uint64_t offset, uint8_t *ptrData, uint64_t dataLength)
     //
-    //! \brief   Description:  Generate a 64bit (psuedo) random number using the xorshiftplus alorithm http://en.wikipedia.org/wiki/Xorshift. This was chosen for implemtnation for being fast and light weight
+    //! \brief   Description:  Fills a buffer with the part of a seekable random stream that starts at offset. Every 8 bytes of the stream are a SplitMix64 value computed directly from (seed, position),
+    //!                        so any region (ex: an LBA range of a drive written with the stream) can be generated without generating everything before it. Use verify_Random_Pattern_At_Offset to check data read back later.
     //
     //  Entry:
+    //!   \param[in] seed = seed of the stream
+    //!   \param[in] offset = byte offset in the stream of the first byte to write to ptrData. Does not need to be aligned.
+    //!   \param[out] ptrData = pointer to the data buffer to fill
+    //!   \param[in] dataLength = size of the data buffer in bytes
     //!
     //  Exit:
-    //!   \return random number
+    //!   \return SUCCESS = successfully filled buffer. BAD_PARAMETER = error in function parameters
     //
     //-----------------------------------------------------------------------------
-    uint64_t xorshiftplus64(void);
+    int fill_Random_Pattern_At_Offset(uint64_t seed, uint64_t offset, uint8_t *ptrData, uint64_t dataLength);
 
     //-----------------------------------------------------------------------------
     //
-    //  random_Range_32()
+    //  verify_Random_Pattern_At_Offset(uint64_t seed, uint64_t offset, const uint8_t *ptrData, uint64_t dataLength, uint64_t *firstMismatchOffset)
     //
-    //! \brief   Description:  Generate a 32bit (psuedo) random number using the xorshiftplus alorithm within the specified range (slightly biased)
+    //! \brief   Description:  Checks a buffer against the part of the random stream fill_Random_Pattern_At_Offset would write for the same seed and offset, without needing a copy of the expected data.
     //
     //  Entry:
-    //!   \param[in] rangeMin = value to use for minimum value of range
-    //!   \param[in] rangeMax = value to use for maximum value of range
+    //!   \param[in] seed = seed of the stream
+    //!   \param[in] offset = byte offset in the stream of the first byte in ptrData
+    //!   \param[in] ptrData = pointer to the data buffer to check
+    //!   \param[in] dataLength = size of the data buffer in bytes
+    //!   \param[out] firstMismatchOffset = optional pointer to hold the stream offset (offset + index in ptrData) of the first byte that does not match. Not changed if all the data matches. May be NULL.
     //!
     //  Exit:
-    //!   \return random number
+    //!   \return SUCCESS = all data matches. FAILURE = at least one byte does not match. BAD_PARAMETER = error in function parameters
     //
     //-----------------------------------------------------------------------------
-    uint32_t random_Range_32(uint32_t rangeMin, uint32_t rangeMax);
+    int verify_Random_Pattern_At_Offset(uint64_t seed, uint64_t offset, const uint8_t *ptrData, uint64_t dataLength, uint64_t *firstMismatchOffset);
 
     //-----------------------------------------------------------------------------
     //
-    //  random_Range_64()
+    //  convert_128bit_to_double(uint8_t * pData)
     //
-    //! \brief   Description:  Generate a 64bit (psuedo) random number using the xorshiftplus alorithm within the specified range (slightly biased)
+    //! \brief   Description:  Converts a 16 byte little endian value (NVMe SMART counters, etc) to a double. Doubles only hold 53 bits of precision, so large values are rounded.
+    //!                        Use load_128bit_LE_Array() and uint128_To_Decimal_String() when the exact value is needed.
     //
     //  Entry:
-    //!   \param[in] rangeMin = value to use for minimum value of range
-    //!   \param[in] rangeMax = value to use for maximum value of range
+    //!   \param[in] pData = pointer to the 16 byte little endian value
     //!
     //  Exit:
-    //!   \return random number
+    //!   \return the value as a double
     //
     //-----------------------------------------------------------------------------
-    uint64_t random_Range_64(uint64_t rangeMin, uint64_t rangeMax);
+    double convert_128bit_to_double(uint8_t * pData);
+
+    //128bit unsigned integer. This uses the compiler's native 128bit type when it has one, otherwise it is a pair of 64bit values.
+    //Use the uint128_ functions below to work with these values so that code works the same with either definition.
+    #if defined (__SIZEOF_INT128__)
+        #define OPENSEA_NATIVE_UINT128
+        __extension__ typedef unsigned __int128 seauint128_t;
+    #else
+        typedef struct _seauint128_t
+        {
+            uint64_t lower;
+            uint64_t upper;
+        }seauint128_t;
+    #endif
+
+    //39 digits for the largest 128bit value plus a null terminator
+    #define UINT128_DECIMAL_STRING_LENGTH 40
 
     //-----------------------------------------------------------------------------
     //
-    //  fill_Random_Pattern_In_Buffer(uint8_t *ptrData, uint32_t dataLength)
+    //  uint128_Make(), uint128_Upper(), uint128_Lower()
+    //
+    //! \brief   Description:  Create a 128bit value from two 64bit halves, or get either 64bit half of a 128bit value
+    //
+    //-----------------------------------------------------------------------------
+    M_STATIC_INLINE seauint128_t uint128_Make(uint64_t upper, uint64_t lower)
+    {
+    #if defined (OPENSEA_NATIVE_UINT128)
+        return ((seauint128_t)upper << 64) | lower;
+    #else
+        seauint128_t value;
+        value.upper = upper;
+        value.lower = lower;
+        return value;
+    #endif
+    }
+
+    M_STATIC_INLINE uint64_t uint128_Upper(seauint128_t value)
+    {
+    #if defined (OPENSEA_NATIVE_UINT128)
+        return (uint64_t)(value >> 64);
+    #else
+        return value.upper;
+    #endif
+    }
+
+    M_STATIC_INLINE uint64_t uint128_Lower(seauint128_t value)
+    {
+    #if defined (OPENSEA_NATIVE_UINT128)
+        return (uint64_t)value;
+    #else
+        return value.lower;
+    #endif
+    }
+
+    //-----------------------------------------------------------------------------
+    //
+    //  uint128_Add(), uint128_Subtract()
+    //
+    //! \brief   Description:  Add or subtract two 128bit values. Results wrap around the same way as the built in unsigned types.
+    //
+    //-----------------------------------------------------------------------------
+    M_STATIC_INLINE seauint128_t uint128_Add(seauint128_t a, seauint128_t b)
+    {
+    #if defined (OPENSEA_NATIVE_UINT128)
+        return a + b;
+    #else
+        seauint128_t result;
+        result.lower = a.lower + b.lower;
+        result.upper = a.upper + b.upper + (result.lower < a.lower ? 1 : 0);
+        return result;
+    #endif
+    }
+
+    M_STATIC_INLINE seauint128_t uint128_Subtract(seauint128_t a, seauint128_t b)
+    {
+    #if defined (OPENSEA_NATIVE_UINT128)
+        return a - b;
+    #else
+        seauint128_t result;
+        result.lower = a.lower - b.lower;
+        result.upper = a.upper - b.upper - (a.lower < b.lower ? 1 : 0);
+        return result;
+    #endif
+    }
+
+    //-----------------------------------------------------------------------------
+    //
+    //  uint128_Compare()
+    //
+    //! \brief   Description:  Compare two 128bit values
+    //
+    //  Exit:
+    //!   \return -1 if a < b, 0 if a == b, 1 if a > b
+    //
+    //-----------------------------------------------------------------------------
+    M_STATIC_INLINE int uint128_Compare(seauint128_t a, seauint128_t b)
+    {
+        if (uint128_Upper(a) != uint128_Upper(b))
+        {
+            return uint128_Upper(a) < uint128_Upper(b) ? -1 : 1;
+        }
+        if (uint128_Lower(a) != uint128_Lower(b))
+        {
+            return uint128_Lower(a) < uint128_Lower(b) ? -1 : 1;
+        }
+        return 0;
+    }
+
+    //-----------------------------------------------------------------------------
+    //
+    //  uint128_From_LE_Bytes()
+    //
+    //! \brief   Description:  Reads a 16 byte little endian value from a buffer (ex: NVMe SMART/Health log counters). The pointer does not need to be aligned.
+    //
+    //-----------------------------------------------------------------------------
+    M_STATIC_INLINE seauint128_t uint128_From_LE_Bytes(const uint8_t *ptr)
+    {
+        return uint128_Make(le64_Load(&ptr[8]), le64_Load(&ptr[0]));
+    }
+
+    //-----------------------------------------------------------------------------
+    //
+    //  uint128_Divide_By_Uint32()
     //
-    //! \brief   Description:  Fills a buffer with random data. Data length must be at least sizeof(uint32_t) in size (4 bytes)
+    //! \brief   Description:  Divides a 128bit value by a 32bit value. Useful for scaling counters (ex: NVMe data units are 1000 512B units).
     //
     //  Entry:
-    //!   \param[out] ptrData = pointer to the data buffer to fill
-    //!   \param[in] dataLength = size of the data buffer in bytes (must be at least 4 bytes in size)
+    //!   \param[in] dividend = value to divide
+    //!   \param[in] divisor = value to divide by. Must not be zero.
+    //!   \param[out] remainder = (optional) the remainder of the division. May be NULL.
     //!
     //  Exit:
-    //!   \return SUCCESS = successfully filled buffer. BAD_PARAMETER = error in function parameters
+    //!   \return the quotient
     //
     //-----------------------------------------------------------------------------
-    int fill_Random_Pattern_In_Buffer(uint8_t *ptrData, uint32_t dataLength);
+    seauint128_t uint128_Divide_By_Uint32(seauint128_t dividend, uint32_t divisor, uint32_t *remainder);
 
     //-----------------------------------------------------------------------------
     //
-    //  fill_Hex_Pattern_In_Buffer(uint32_t hexPattern, uint8_t *ptrData, uint32_t dataLength)
+    //  uint128_To_Decimal_String()
     //
-    //! \brief   Description:  Fills a buffer with a hexadecimal pattern. The pattern is 32bits in length.
+    //! \brief   Description:  Converts a 128bit value to an exact decimal string. No floating point math is used.
     //
     //  Entry:
-    //!   \param[in] hexPattern = 32bit hexadecimal pattern to put into buffer.
-    //!   \param[out] ptrData = pointer to the data buffer to fill
-    //!   \param[in] dataLength = size of the data buffer in bytes (must be at least 4 bytes in size)
+    //!   \param[in] value = value to convert
+    //!   \param[out] buffer = buffer to write the null terminated string to. UINT128_DECIMAL_STRING_LENGTH is always large enough.
+    //!   \param[in] bufferSize = size of the buffer in bytes
     //!
     //  Exit:
-    //!   \return SUCCESS = successfully filled buffer. BAD_PARAMETER = error in function parameters
+    //!   \return length of the string (not including the null terminator). 0 if the buffer is too small, in which case the buffer is not changed.
     //
     //-----------------------------------------------------------------------------
-    int fill_Hex_Pattern_In_Buffer(uint32_t hexPattern, uint8_t *ptrData, uint32_t dataLength);
+    size_t uint128_To_Decimal_String(seauint128_t value, char *buffer, size_t bufferSize);
 
     //-----------------------------------------------------------------------------
     //
-    //  fill_Incrementing_Pattern_In_Buffer(uint8_t incrementStartValue, uint8_t *ptrData, uint32_t dataLength)
+    //  load_128bit_LE_Array()
     //
-    //! \brief   Description:  Fills a buffer with a incrementing pattern from a starting point
+    //! \brief   Description:  Reads an array of 16 byte little endian counters (ex: the NVMe SMART/Health log) into 128bit values
     //
     //  Entry:
-    //!   \param[in] incrementStartValue = value to start incrementing from.
-    //!   \param[out] ptrData = pointer to the data buffer to fill
-    //!   \param[in] dataLength = size of the data buffer in bytes.
+    //!   \param[in] pData = pointer to the first counter. Does not need to be aligned.
+    //!   \param[out] values = array to store the values in. Must have room for count values.
+    //!   \param[in] count = number of counters to read
     //!
     //  Exit:
-    //!   \return SUCCESS = successfully filled buffer. BAD_PARAMETER = error in function parameters
+    //!   \return VOID
     //
     //-----------------------------------------------------------------------------
-    int fill_Incrementing_Pattern_In_Buffer(uint8_t incrementStartValue, uint8_t *ptrData, uint32_t dataLength);
+    void load_128bit_LE_Array(const uint8_t *pData, seauint128_t *values, size_t count);
+
+    //buffer sizes, including the null terminator, that always hold the output of the format_* functions below
+    #define UINT64_DECIMAL_STRING_LENGTH 21
+    #define INT64_DECIMAL_STRING_LENGTH 21
+    #define UINT64_HEX_STRING_LENGTH 17
+    #define INT64_HEX_STRING_LENGTH 18
 
     //-----------------------------------------------------------------------------
     //
-    //  fill_ASCII_Pattern_In_Buffer(const char *asciiPattern, uint32_t patternLength, uint8_t *ptrData, uint32_t dataLength)
+    //  format_Uint64_Decimal(), format_Int64_Decimal()
     //
-    //! \brief   Description:  Fills a buffer with an ASCII pattern (string).
+    //! \brief   Description:  Write an integer as a decimal string without going through printf. Digits are produced two at a time from a lookup table.
     //
     //  Entry:
-    //!   \param[in] asciiPattern = pointer to ASCII pattern (string)
-    //!   \param[in] patternLength = length of the ASCII pattern
-    //!   \param[out] ptrData = pointer to the data buffer to fill
-    //!   \param[in] dataLength = size of the data buffer in bytes.
+    //!   \param[in] value = value to format
+    //!   \param[out] buffer = buffer to write the null terminated string to. UINT64_DECIMAL_STRING_LENGTH/INT64_DECIMAL_STRING_LENGTH is always large enough.
+    //!   \param[in] bufferSize = size of buffer in bytes
     //!
     //  Exit:
-    //!   \return SUCCESS = successfully filled buffer. BAD_PARAMETER = error in function parameters
+    //!   \return length of the string written, not counting the null terminator. 0 if buffer is NULL or too small (nothing is written).
     //
     //-----------------------------------------------------------------------------
-    int fill_ASCII_Pattern_In_Buffer(const char *asciiPattern, uint32_t patternLength, uint8_t *ptrData, uint32_t dataLength);
+    size_t format_Uint64_Decimal(uint64_t value, char *buffer, size_t bufferSize);
+
+    size_t format_Int64_Decimal(int64_t value, char *buffer, size_t bufferSize);
 
     //-----------------------------------------------------------------------------
     //
-    //  fill_Pattern_Buffer_Into_Another_Buffer(uint8_t *inPattern, uint32_t inpatternLength, uint8_t *ptrData, uint32_t dataLength)
+    //  format_Uint64_Hex(), format_Int64_Hex()
     //
-    //! \brief   Description:  Fills a buffer from a pattern memory buffer and will repeat the pattern to fill the out buffer. (i.e., 1 sector in gets copied and put into all 4 sectors out)
+    //! \brief   Description:  Write an integer as an uppercase hex string (no 0x prefix) without going through printf. Negative values of format_Int64_Hex are written as - followed by the magnitude.
     //
     //  Entry:
-    //!   \param[in] inPattern = pointer to a uint8 buffer
-    //!   \param[in] inpatternLength = length of the incomming pattern
-    //!   \param[out] ptrData = pointer to the data buffer to fill
-    //!   \param[in] dataLength = size of the data buffer in bytes.
+    //!   \param[in] value = value to format
+    //!   \param[in] width = minimum number of hex digits. The value is zero padded to this width (same as %0*X). Values over 16 are treated as 16.
+    //!   \param[out] buffer = buffer to write the null terminated string to. UINT64_HEX_STRING_LENGTH/INT64_HEX_STRING_LENGTH is always large enough.
+    //!   \param[in] bufferSize = size of buffer in bytes
     //!
     //  Exit:
-    //!   \return SUCCESS = successfully filled buffer. BAD_PARAMETER = error in function parameters
+    //!   \return length of the string written, not counting the null terminator. 0 if buffer is NULL or too small (nothing is written).
     //
     //-----------------------------------------------------------------------------
-    int fill_Pattern_Buffer_Into_Another_Buffer(uint8_t *inPattern, uint32_t inpatternLength, uint8_t *ptrData, uint32_t dataLength);
+    size_t format_Uint64_Hex(uint64_t value, uint8_t width, char *buffer, size_t bufferSize);
 
-    double convert_128bit_to_double(uint8_t * pData);
+    size_t format_Int64_Hex(int64_t value, uint8_t width, char *buffer, size_t bufferSize);
 
     //-----------------------------------------------------------------------------
     //
     //  get_Future_Date_And_Time()
     //
     //! \brief   Description:  Takes an input time, and an amount of time in the future, and returns it in a time_t type. This function exists because C standard does not specify how time_t is stored.
-    //!                        POSIX specifies it's a number of seconds since Jan 1, 1970 UTC, but that is not portable which is why this function uses ctime to try to be portable regardless of how time_t is stored internally by the compiler.
+    //!                        POSIX and Windows store it as a number of seconds since Jan 1, 1970 UTC, so the seconds are added directly, saturating at the largest time_t. This function is thread safe.
+    //!                        Since the seconds are added directly, the result is not adjusted for daylight saving time. If a DST change falls between the two times, the local wall clock time of the result is an hour off from what adding the time through localtime and mktime would give.
     //
     //  Entry:
     //!   \param[in] inputTime = time_t value representing a time to use as the input for the future time calculation
@@ -988,6 +2324,104 @@ extern "C"
     //-----------------------------------------------------------------------------
     time_t get_Future_Date_And_Time(time_t inputTime, uint64_t secondsInTheFuture);
 
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Future_Date_And_Time_Array()
+    //
+    //! \brief   Description:  Same as get_Future_Date_And_Time for a list of times in the future from the same starting time. Useful for estimating completion times for many operations at once.
+    //
+    //  Entry:
+    //!   \param[in] inputTime = time_t value representing a time to use as the input for the future time calculations
+    //!   \param[in] secondsInTheFuture = array of the numbers of seconds in the future
+    //!   \param[out] futureTimes = array to hold the time_t value for each entry in secondsInTheFuture
+    //!   \param[in] count = number of entries in secondsInTheFuture and futureTimes
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    void get_Future_Date_And_Time_Array(time_t inputTime, const uint64_t *secondsInTheFuture, time_t *futureTimes, size_t count);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  civil_From_Days()
+    //
+    //! \brief   Description:  Convert a number of days since Jan 1, 1970 to a date on the (proleptic) Gregorian calendar. No loops or tables are used, and any 64bit day number is handled.
+    //
+    //  Entry:
+    //!   \param[in] daysSinceEpoch = number of days since Jan 1, 1970. Negative for days before that.
+    //!   \param[out] year = pointer to hold the full year (ex: 2017). May be NULL.
+    //!   \param[out] month = pointer to hold the month of the year, 1 - 12. May be NULL.
+    //!   \param[out] day = pointer to hold the day of the month, 1 - 31. May be NULL.
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    void civil_From_Days(int64_t daysSinceEpoch, int64_t *year, uint8_t *month, uint8_t *day);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Localtime()
+    //
+    //! \brief   Description:  Thread safe version of localtime. Uses localtime_r or localtime_s when available.
+    //
+    //  Entry:
+    //!   \param[in] timer = pointer to the time to convert
+    //!   \param[out] localTime = pointer to the struct tm to fill in with the local time
+    //!
+    //  Exit:
+    //!   \return localTime on success, NULL if the time could not be converted
+    //
+    //-----------------------------------------------------------------------------
+    struct tm* get_Localtime(const time_t *timer, struct tm *localTime);
+
+    typedef enum _eTimestampFormat
+    {
+        TIMESTAMP_FORMAT_LOCAL, //ISO 8601 local time with milliseconds. 2017-03-14T15:09:26.535
+        TIMESTAMP_FORMAT_UTC    //ISO 8601 UTC with milliseconds. 2017-03-14T20:09:26.535Z
+    }eTimestampFormat;
+
+    //large enough for any timestamp format above, including a null terminator and years past 9999
+    #define TIMESTAMP_STRING_LENGTH 32
+
+    //returned by get_Current_Timestamp in place of a time when the time cannot be converted (localtime failed)
+    #define TIMESTAMP_UNKNOWN_STRING "Unknown time"
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Current_Timestamp()
+    //
+    //! \brief   Description:  Get the current time as a formatted string for stamping log messages or output. The time is read from a coarse (millisecond-ish resolution) clock and each thread keeps its own copy of the string.
+    //!                        The date and time up to the minute is only rebuilt (with localtime) when the minute changes. Otherwise only the seconds and milliseconds are rewritten, so this is much cheaper than time + localtime + strftime.
+    //
+    //  Entry:
+    //!   \param[in] format = which format to write the time in
+    //!   \param[out] currentTime = optional pointer to hold the time the string was made from. May be NULL.
+    //!
+    //  Exit:
+    //!   \return pointer to a null terminated string owned by the calling thread. It stays valid until the next call from the same thread with the same format.
+    //!            If the time cannot be converted, the string is TIMESTAMP_UNKNOWN_STRING instead of a time. currentTime is still set.
+    //
+    //-----------------------------------------------------------------------------
+    const char* get_Current_Timestamp(eTimestampFormat format, time_t *currentTime);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  update_Current_Time()
+    //
+    //! \brief   Description:  Sets g_currentTime to the current time and g_currentTimeString (and g_currentTimeStringPtr) to it as a TIMESTAMP_FORMAT_LOCAL string, using the same cached formatting as get_Current_Timestamp.
+    //!                        If the time cannot be converted, g_currentTimeString is set to TIMESTAMP_UNKNOWN_STRING.
+    //!                        The globals are shared by all threads, so multithreaded code should use get_Current_Timestamp instead.
+    //
+    //  Entry:
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    void update_Current_Time(void);
+
     typedef enum _eCompiler
     {
         OPENSEA_COMPILER_UNKNOWN,
@@ -1042,6 +2476,21 @@ extern "C"
     //-----------------------------------------------------------------------------
     void print_Compiler(eCompiler compilerUsed);
 
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Compiler_String(eCompiler compilerUsed)
+    //
+    //! \brief   Description:  This takes an eCompiler type and gets the name of the compiler (same text as print_Compiler). The string is from a static table, so it is safe to use from any thread and must not be freed.
+    //
+    //  Entry:
+    //!   \param[in] compilerUsed = eCompiler type to get the name of
+    //!
+    //  Exit:
+    //!   \return pointer to a constant string naming the compiler
+    //
+    //-----------------------------------------------------------------------------
+    const char* get_Compiler_String(eCompiler compilerUsed);
+
     //-----------------------------------------------------------------------------
     //
     //  print_Compiler_Version_Info(ptrCompilerVersion compilerVersionInfo)
@@ -1088,6 +2537,147 @@ extern "C"
     //-----------------------------------------------------------------------------
     void print_Errno_To_Screen(int error);
 
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Errno_String(int error)
+    //
+    //! \brief   Description:  Gets the meaning of an error number. The error strings are looked up once (with strerror_r/strerror_s) the first time this is called and cached in a table,
+    //!                        so this is safe to call from multiple threads and does not format anything after the first call.
+    //
+    //  Entry:
+    //!   \param[in] error = error number to look up
+    //!
+    //  Exit:
+    //!   \return pointer to a constant string describing the error. Must not be freed. Error numbers past the cached table return "Unknown error <number>" in a per thread buffer that is reused by the next such call.
+    //
+    //-----------------------------------------------------------------------------
+    const char* get_Errno_String(int error);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  stringBuilder
+    //
+    //! \brief   Description:  Tracks a string being built up from pieces so that appends do not need to rescan the string with strlen/strcat.
+    //!                        The builder starts on a caller provided buffer (usually on the stack). If growth is allowed, the builder moves to heap memory once that buffer is full,
+    //!                        otherwise the output is truncated to fit and the truncated flag is set. The buffer is always kept null terminated.
+    //!                        Call string_Builder_Free when done to release any heap memory the builder allocated.
+    //
+    //-----------------------------------------------------------------------------
+    typedef struct _stringBuilder
+    {
+        char *buffer;       //current string. May be NULL only if no buffer was given at init and nothing has been appended yet.
+        size_t length;      //length of the string in buffer, not counting the null terminator
+        size_t capacity;    //size of buffer in bytes, including space for the null terminator
+        bool allowGrowth;   //set to allow the builder to allocate a larger buffer when it runs out of room
+        bool ownsBuffer;    //set when buffer was allocated by the builder and needs to be freed
+        bool truncated;     //set when something could not be appended completely
+    }stringBuilder, *ptrStringBuilder;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  string_Builder_Init()
+    //
+    //! \brief   Description:  Initialize a string builder to start building an empty string in the provided buffer.
+    //
+    //  Entry:
+    //!   \param[out] builder = pointer to the string builder to initialize
+    //!   \param[in] buffer = starting buffer for the string. May be NULL when bufferSize is 0 and allowGrowth is true to always build on the heap.
+    //!   \param[in] bufferSize = size of buffer in bytes
+    //!   \param[in] allowGrowth = set to true to allow moving to heap memory when buffer is full. When false, output that does not fit is truncated.
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    void string_Builder_Init(stringBuilder *builder, char *buffer, size_t bufferSize, bool allowGrowth);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  string_Builder_Free()
+    //
+    //! \brief   Description:  Free any heap memory allocated by the string builder. The builder is left empty and without a buffer.
+    //
+    //  Entry:
+    //!   \param[in] builder = pointer to the string builder
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    void string_Builder_Free(stringBuilder *builder);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  string_Builder_Reset()
+    //
+    //! \brief   Description:  Empty the string in the builder so it can be reused. The current buffer is kept.
+    //
+    //  Entry:
+    //!   \param[in] builder = pointer to the string builder
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    void string_Builder_Reset(stringBuilder *builder);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  string_Builder_Append(), string_Builder_Append_String(), string_Builder_Append_Char()
+    //
+    //! \brief   Description:  Append characters to the end of the string in the builder.
+    //
+    //  Entry:
+    //!   \param[in] builder = pointer to the string builder
+    //!   \param[in] string = characters to append. string_Builder_Append takes a length so the string does not need to be null terminated.
+    //!   \param[in] length = number of characters to append
+    //!
+    //  Exit:
+    //!   \return SUCCESS = everything was appended, FAILURE = the output was truncated to fit, MEMORY_FAILURE = unable to grow the buffer (output was truncated), BAD_PARAMETER = invalid pointer
+    //
+    //-----------------------------------------------------------------------------
+    int string_Builder_Append(stringBuilder *builder, const char *string, size_t length);
+
+    int string_Builder_Append_String(stringBuilder *builder, const char *string);
+
+    int string_Builder_Append_Char(stringBuilder *builder, char character);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  string_Builder_Append_Uint64(), string_Builder_Append_Hex()
+    //
+    //! \brief   Description:  Append an integer in decimal or in uppercase hex (without a leading 0x) to the string in the builder.
+    //
+    //  Entry:
+    //!   \param[in] builder = pointer to the string builder
+    //!   \param[in] value = value to append
+    //!   \param[in] minDigits = minimum number of hex digits to print. The value is zero padded to this width.
+    //!
+    //  Exit:
+    //!   \return same as string_Builder_Append
+    //
+    //-----------------------------------------------------------------------------
+    int string_Builder_Append_Uint64(stringBuilder *builder, uint64_t value);
+
+    int string_Builder_Append_Hex(stringBuilder *builder, uint64_t value, uint8_t minDigits);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  string_Builder_Append_Format()
+    //
+    //! \brief   Description:  Append printf style formatted output to the string in the builder.
+    //
+    //  Entry:
+    //!   \param[in] builder = pointer to the string builder
+    //!   \param[in] format = printf style format string
+    //!   \param[in] ... = arguments for the format string
+    //!
+    //  Exit:
+    //!   \return same as string_Builder_Append
+    //
+    //-----------------------------------------------------------------------------
+    int string_Builder_Append_Format(stringBuilder *builder, const char *format, ...);
+
     //-----------------------------------------------------------------------------
     //
     //  custom_Update(void *customData, char *message)
@@ -202,6 +202,21 @@ extern "C"
     //-----------------------------------------------------------------------------
     void print_Architecture(eArchitecture arch);
 
+    //-----------------------------------------------------------------------------
+    //
+    // get_Architecture_String(eArchitecture arch)
+    //
+    // \brief   Description: Gets the architecture in human readable form (same text as print_Architecture). The string is from a static table, so it is safe to use from any thread and must not be freed.
+    //
+    // Entry:
+    //      \param[in] arch - eArchitecure type to get the name of
+    //
+    // Exit:
+    //      \return pointer to a constant string naming the architecture
+    //
+    //-----------------------------------------------------------------------------
+    const char* get_Architecture_String(eArchitecture arch);
+
     typedef enum _eEndianness
     {
         OPENSEA_LITTLE_ENDIAN,
@@ -242,6 +257,22 @@ extern "C"
     //-----------------------------------------------------------------------------
     void print_Endianness(eEndianness endian, bool shortPrint);
 
+    //-----------------------------------------------------------------------------
+    //
+    // get_Endianness_String(eEndianness endian, bool shortPrint)
+    //
+    // \brief   Description: Gets the endianness in human readable form (same text as print_Endianness). The string is from a static table, so it is safe to use from any thread and must not be freed.
+    //
+    // Entry:
+    //      \param[in] endian - eEndianness type
+    //      \param[in] shortPrint - get the 3 digit short hand endianness or long version
+    //
+    // Exit:
+    //      \return pointer to a constant string naming the endianness
+    //
+    //-----------------------------------------------------------------------------
+    const char* get_Endianness_String(eEndianness endian, bool shortPrint);
+
     //Not all of these are supported at this time.
     typedef enum _eOSType
     {
@@ -395,6 +426,21 @@ extern "C"
     //-----------------------------------------------------------------------------
     void print_OS_Type(eOSType osType);
 
+    //-----------------------------------------------------------------------------
+    //
+    // get_OS_Type_String(eOSType osType)
+    //
+    // \brief   Description: Gets the OS Type enum in human readable form (same text as print_OS_Type). The string is from a static table, so it is safe to use from any thread and must not be freed.
+    //
+    // Entry:
+    //      \param[in] osType - eOSType type to get the name of
+    //
+    // Exit:
+    //      \return pointer to a constant string naming the OS type
+    //
+    //-----------------------------------------------------------------------------
+    const char* get_OS_Type_String(eOSType osType);
+
     //-----------------------------------------------------------------------------
     //
     // print_OS_Version(ptrOSVersionNumber versionNumber, eOSType osType)
@@ -521,6 +567,23 @@ extern "C"
     //-----------------------------------------------------------------------------
     double get_Seconds(seatimer_t timer);
 
+    //-----------------------------------------------------------------------------
+    //
+    // void get_Coarse_Wall_Clock(int64_t *secondsSinceEpoch, uint32_t *nanoseconds)
+    //
+    // \brief   Description: Reads the current wall clock time (UTC) from the cheapest clock the system offers. This is CLOCK_REALTIME_COARSE when it is available and GetSystemTimeAsFileTime on Windows.
+    //                       The resolution is only a few milliseconds, which is plenty for timestamping output, and it can usually be read without entering the kernel.
+    //
+    // Entry:
+    //      \param[out] secondsSinceEpoch - pointer to hold the number of seconds since Jan 1, 1970 UTC.
+    //      \param[out] nanoseconds - pointer to hold the nanoseconds into the current second. May be NULL.
+    //
+    // Exit:
+    //      \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    void get_Coarse_Wall_Clock(int64_t *secondsSinceEpoch, uint32_t *nanoseconds);
+
 #if defined (__cplusplus)
 } //extern "C"
 #endif
@@ -17,11 +17,170 @@
 
 #if defined (_WIN32)
 #include "windows.h" //used for setting color output to the command prompt and Sleep()
+#include <io.h> //_write
 #else
 #include <unistd.h> //needed for usleep() or nanosleep()
 #include <time.h>
 #include <errno.h>
+#include <pthread.h> //pthread_once
 #endif
+#include <stdarg.h>
+
+//SIMD instruction sets. These are only used when the compiler says the target being built for supports them, otherwise the plain C versions of each function are used.
+//MSVC doesn't define __SSE2__, but all x64 targets and x86 targets built with /arch:SSE2 or higher have it. - TJE
+#if defined (__SSE2__) || defined (_M_X64) || defined (_M_AMD64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define OPENSEA_SIMD_SSE2
+    #include <emmintrin.h>
+    #if defined (__SSSE3__)
+        #define OPENSEA_SIMD_SSSE3
+        #include <tmmintrin.h>
+    #endif
+#elif defined (__ARM_NEON) || defined (__ARM_NEON__)
+    #define OPENSEA_SIMD_NEON
+    #include <arm_neon.h>
+#endif
+
+//_pext_u64 only exists in 64bit x86 builds. 32bit builds with BMI2 enabled use the plain C version.
+#if (defined (__BMI2__) || (defined (_MSC_VER) && defined (__AVX2__))) && (defined (__x86_64__) || defined (_M_X64) || defined (_M_AMD64))
+    #define OPENSEA_BMI2
+    #include <immintrin.h>
+#endif
+
+#if defined (_MSC_VER)
+#include <intrin.h> //_BitScanForward, _BitScanReverse
+#endif
+
+//returns the index of the lowest set bit. Value must not be zero
+M_STATIC_INLINE uint8_t lowest_Set_Bit_32(uint32_t value)
+{
+#if defined (__GNUC__) || defined (__clang__)
+    return (uint8_t)__builtin_ctz(value);
+#elif defined (_MSC_VER)
+    unsigned long index = 0;
+    _BitScanForward(&index, value);
+    return (uint8_t)index;
+#else
+    uint8_t index = 0;
+    while (!(value & 1))
+    {
+        value >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+//returns the index of the lowest set bit. Value must not be zero
+M_STATIC_INLINE uint8_t lowest_Set_Bit_64(uint64_t value)
+{
+#if defined (__GNUC__) || defined (__clang__)
+    return (uint8_t)__builtin_ctzll(value);
+#else
+    if (M_DoubleWord0(value))
+    {
+        return lowest_Set_Bit_32(M_DoubleWord0(value));
+    }
+    return (uint8_t)(32 + lowest_Set_Bit_32(M_DoubleWord1(value)));
+#endif
+}
+
+//returns the index of the highest set bit. Value must not be zero
+M_STATIC_INLINE uint8_t highest_Set_Bit_32(uint32_t value)
+{
+#if defined (__GNUC__) || defined (__clang__)
+    return (uint8_t)(31 - __builtin_clz(value));
+#elif defined (_MSC_VER)
+    unsigned long index = 0;
+    _BitScanReverse(&index, value);
+    return (uint8_t)index;
+#else
+    uint8_t index = 0;
+    while (value >>= 1)
+    {
+        ++index;
+    }
+    return index;
+#endif
+}
+
+//returns the index of the highest set bit. Value must not be zero
+M_STATIC_INLINE uint8_t highest_Set_Bit_64(uint64_t value)
+{
+#if defined (__GNUC__) || defined (__clang__)
+    return (uint8_t)(63 - __builtin_clzll(value));
+#else
+    if (M_DoubleWord1(value))
+    {
+        return (uint8_t)(32 + highest_Set_Bit_32(M_DoubleWord1(value)));
+    }
+    return highest_Set_Bit_32(M_DoubleWord0(value));
+#endif
+}
+
+//"00" - "99". Two decimal digits are written per division so that converting a value takes half as many divisions.
+static const char decimalDigitPairs[201] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+//"00" - "FF". Indexed by byte value * 2 to get both hex digits of a byte at once.
+static const char hexDigitPairs[513] =
+    "000102030405060708090A0B0C0D0E0F101112131415161718191A1B1C1D1E1F"
+    "202122232425262728292A2B2C2D2E2F303132333435363738393A3B3C3D3E3F"
+    "404142434445464748494A4B4C4D4E4F505152535455565758595A5B5C5D5E5F"
+    "606162636465666768696A6B6C6D6E6F707172737475767778797A7B7C7D7E7F"
+    "808182838485868788898A8B8C8D8E8F909192939495969798999A9B9C9D9E9F"
+    "A0A1A2A3A4A5A6A7A8A9AAABACADAEAFB0B1B2B3B4B5B6B7B8B9BABBBCBDBEBF"
+    "C0C1C2C3C4C5C6C7C8C9CACBCCCDCECFD0D1D2D3D4D5D6D7D8D9DADBDCDDDEDF"
+    "E0E1E2E3E4E5E6E7E8E9EAEBECEDEEEFF0F1F2F3F4F5F6F7F8F9FAFBFCFDFEFF";
+
+//writes the digits of a value to the end of the digits buffer (right aligned) and returns how many digits were written. If minDigits is set, the value is zero padded to that many digits.
+static size_t uint64_To_Decimal_Digits(uint64_t value, char *digitsEnd, size_t minDigits)
+{
+    char *digitsStart = digitsEnd;
+    while (value >= 100)
+    {
+        size_t pairOffset = (size_t)(value % 100) * 2;
+        value /= 100;
+        digitsStart -= 2;
+        digitsStart[0] = decimalDigitPairs[pairOffset];
+        digitsStart[1] = decimalDigitPairs[pairOffset + 1];
+    }
+    if (value >= 10)
+    {
+        digitsStart -= 2;
+        digitsStart[0] = decimalDigitPairs[value * 2];
+        digitsStart[1] = decimalDigitPairs[value * 2 + 1];
+    }
+    else
+    {
+        *--digitsStart = (char)('0' + value);
+    }
+    while ((size_t)(digitsEnd - digitsStart) < minDigits)
+    {
+        *--digitsStart = '0';
+    }
+    return (size_t)(digitsEnd - digitsStart);
+}
+
+//writes all 16 hex digits of a value to the digits buffer, then returns the number of digits that need to be kept to show the value with at least minDigits digits.
+static size_t uint64_To_Hex_Digits(uint64_t value, char digits[16], size_t minDigits)
+{
+    size_t significantDigits = 16;
+    for (size_t byteIter = 0; byteIter < 8; ++byteIter)
+    {
+        size_t pairOffset = (size_t)((value >> (56 - byteIter * 8)) & 0xFF) * 2;
+        digits[byteIter * 2] = hexDigitPairs[pairOffset];
+        digits[byteIter * 2 + 1] = hexDigitPairs[pairOffset + 1];
+    }
+    while (significantDigits > 1 && (value >> ((significantDigits - 1) * 4)) == 0)
+    {
+        --significantDigits;
+    }
+    return M_Max(significantDigits, M_Min(minDigits, 16));
+}
 
 eVerbosityLevels g_verbosity = VERBOSITY_DEFAULT;
 time_t           g_currentTime;
@@ -59,29 +218,22 @@ void nibble_Swap(uint8_t *byteToSwap)
 
 void byte_Swap_16(uint16_t *wordToSwap)
 {
-    *wordToSwap = ((*wordToSwap & 0x00FF) << 8) | ((*wordToSwap & 0xFF00) >> 8);
+    *wordToSwap = M_ByteSwap16(*wordToSwap);
 }
 
 void big_To_Little_Endian_16(uint16_t *wordToSwap)
 {
-	if (get_Compiled_Endianness() == OPENSEA_LITTLE_ENDIAN)
-	{
-		byte_Swap_16(wordToSwap);
-	}
+	*wordToSwap = M_HostToBE16(*wordToSwap);
 }
 
 void byte_Swap_32(uint32_t *doubleWordToSwap)
 {
-    *doubleWordToSwap = ((*doubleWordToSwap & 0x0000FFFF) << 16) | ((*doubleWordToSwap & 0xFFFF0000) >> 16);
-    *doubleWordToSwap = ((*doubleWordToSwap & 0x00FF00FF) << 8) | ((*doubleWordToSwap & 0xFF00FF00) >> 8);
+    *doubleWordToSwap = M_ByteSwap32(*doubleWordToSwap);
 }
 
 void big_To_Little_Endian_32(uint32_t *doubleWordToSwap)
 {
-	if (get_Compiled_Endianness() == OPENSEA_LITTLE_ENDIAN)
-	{
-		byte_Swap_32(doubleWordToSwap);
-	}
+	*doubleWordToSwap = M_HostToBE32(*doubleWordToSwap);
 }
 
 void word_Swap_32(uint32_t *doubleWordToSwap)
@@ -91,9 +243,7 @@ void word_Swap_32(uint32_t *doubleWordToSwap)
 
 void byte_Swap_64(uint64_t *quadWordToSwap)
 {
-    *quadWordToSwap = ((*quadWordToSwap & 0x00000000FFFFFFFFULL) << 32) | ((*quadWordToSwap & 0xFFFFFFFF00000000ULL) >> 32);
-    *quadWordToSwap = ((*quadWordToSwap & 0x0000FFFF0000FFFFULL) << 16) | ((*quadWordToSwap & 0xFFFF0000FFFF0000ULL) >> 16);
-    *quadWordToSwap = ((*quadWordToSwap & 0x00FF00FF00FF00FFULL) << 8) | ((*quadWordToSwap & 0xFF00FF00FF00FF00ULL) >> 8);
+    *quadWordToSwap = M_ByteSwap64(*quadWordToSwap);
 }
 
 void word_Swap_64(uint64_t *quadWordToSwap)
@@ -107,6 +257,189 @@ void double_Word_Swap_64(uint64_t *quadWordToSwap)
     *quadWordToSwap = ((*quadWordToSwap & 0x00000000FFFFFFFFULL) << 32) | ((*quadWordToSwap & 0xFFFFFFFF00000000ULL) >> 32);
 }
 
+//The array versions below swap 16 bytes at a time when SIMD is available and finish any remainder one value at a time.
+//SSE2 doesn't have a byte shuffle, so it swaps the bytes in each 16bit lane with shifts after reordering the 16bit lanes. SSSE3 and NEON can do it with a single shuffle/reverse.
+void byte_Swap_16_Array(uint16_t *wordArray, size_t count)
+{
+    size_t iter = 0;
+    if (!wordArray)
+    {
+        return;
+    }
+#if defined (OPENSEA_SIMD_SSE2)
+    for (; iter + 8 <= count; iter += 8)
+    {
+        __m128i words = _mm_loadu_si128((const __m128i*)&wordArray[iter]);
+        words = _mm_or_si128(_mm_slli_epi16(words, 8), _mm_srli_epi16(words, 8));
+        _mm_storeu_si128((__m128i*)&wordArray[iter], words);
+    }
+#elif defined (OPENSEA_SIMD_NEON)
+    for (; iter + 8 <= count; iter += 8)
+    {
+        uint8x16_t words = vld1q_u8((const uint8_t*)&wordArray[iter]);
+        vst1q_u8((uint8_t*)&wordArray[iter], vrev16q_u8(words));
+    }
+#endif
+    for (; iter < count; ++iter)
+    {
+        wordArray[iter] = M_ByteSwap16(wordArray[iter]);
+    }
+}
+
+void byte_Swap_32_Array(uint32_t *doubleWordArray, size_t count)
+{
+    size_t iter = 0;
+    if (!doubleWordArray)
+    {
+        return;
+    }
+#if defined (OPENSEA_SIMD_SSSE3)
+    const __m128i swapMask = _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+    for (; iter + 4 <= count; iter += 4)
+    {
+        __m128i doubleWords = _mm_loadu_si128((const __m128i*)&doubleWordArray[iter]);
+        _mm_storeu_si128((__m128i*)&doubleWordArray[iter], _mm_shuffle_epi8(doubleWords, swapMask));
+    }
+#elif defined (OPENSEA_SIMD_SSE2)
+    for (; iter + 4 <= count; iter += 4)
+    {
+        __m128i doubleWords = _mm_loadu_si128((const __m128i*)&doubleWordArray[iter]);
+        //swap the words in each double word, then the bytes in each word
+        doubleWords = _mm_shufflehi_epi16(_mm_shufflelo_epi16(doubleWords, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+        doubleWords = _mm_or_si128(_mm_slli_epi16(doubleWords, 8), _mm_srli_epi16(doubleWords, 8));
+        _mm_storeu_si128((__m128i*)&doubleWordArray[iter], doubleWords);
+    }
+#elif defined (OPENSEA_SIMD_NEON)
+    for (; iter + 4 <= count; iter += 4)
+    {
+        uint8x16_t doubleWords = vld1q_u8((const uint8_t*)&doubleWordArray[iter]);
+        vst1q_u8((uint8_t*)&doubleWordArray[iter], vrev32q_u8(doubleWords));
+    }
+#endif
+    for (; iter < count; ++iter)
+    {
+        doubleWordArray[iter] = M_ByteSwap32(doubleWordArray[iter]);
+    }
+}
+
+void byte_Swap_64_Array(uint64_t *quadWordArray, size_t count)
+{
+    size_t iter = 0;
+    if (!quadWordArray)
+    {
+        return;
+    }
+#if defined (OPENSEA_SIMD_SSSE3)
+    const __m128i swapMask = _mm_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7);
+    for (; iter + 2 <= count; iter += 2)
+    {
+        __m128i quadWords = _mm_loadu_si128((const __m128i*)&quadWordArray[iter]);
+        _mm_storeu_si128((__m128i*)&quadWordArray[iter], _mm_shuffle_epi8(quadWords, swapMask));
+    }
+#elif defined (OPENSEA_SIMD_SSE2)
+    for (; iter + 2 <= count; iter += 2)
+    {
+        __m128i quadWords = _mm_loadu_si128((const __m128i*)&quadWordArray[iter]);
+        //reverse the words in each quad word, then the bytes in each word
+        quadWords = _mm_shufflehi_epi16(_mm_shufflelo_epi16(quadWords, _MM_SHUFFLE(0, 1, 2, 3)), _MM_SHUFFLE(0, 1, 2, 3));
+        quadWords = _mm_or_si128(_mm_slli_epi16(quadWords, 8), _mm_srli_epi16(quadWords, 8));
+        _mm_storeu_si128((__m128i*)&quadWordArray[iter], quadWords);
+    }
+#elif defined (OPENSEA_SIMD_NEON)
+    for (; iter + 2 <= count; iter += 2)
+    {
+        uint8x16_t quadWords = vld1q_u8((const uint8_t*)&quadWordArray[iter]);
+        vst1q_u8((uint8_t*)&quadWordArray[iter], vrev64q_u8(quadWords));
+    }
+#endif
+    for (; iter < count; ++iter)
+    {
+        quadWordArray[iter] = M_ByteSwap64(quadWordArray[iter]);
+    }
+}
+
+int decode_Fields(const uint8_t *dataBuffer, size_t dataLength, const fieldDescriptor *fields, size_t fieldCount)
+{
+    if (!dataBuffer || (!fields && fieldCount > 0))
+    {
+        return BAD_PARAMETER;
+    }
+    for (size_t fieldIter = 0; fieldIter < fieldCount; ++fieldIter)
+    {
+        const fieldDescriptor *field = &fields[fieldIter];
+        const uint8_t *fieldPtr = NULL;
+        uint64_t value = 0;
+        bool bigEndian = field->byteOrder == FIELD_BIG_ENDIAN;
+        if (!field->destination || field->msb < field->lsb || field->msb >= (field->width * 8) || field->offset > dataLength || field->width > (dataLength - field->offset))
+        {
+            return BAD_PARAMETER;
+        }
+        fieldPtr = &dataBuffer[field->offset];
+        switch (field->width)
+        {
+        case 1:
+            value = *fieldPtr;
+            break;
+        case 2:
+            value = bigEndian ? be16_Load(fieldPtr) : le16_Load(fieldPtr);
+            break;
+        case 4:
+            value = bigEndian ? be32_Load(fieldPtr) : le32_Load(fieldPtr);
+            break;
+        case 8:
+            value = bigEndian ? be64_Load(fieldPtr) : le64_Load(fieldPtr);
+            break;
+        default:
+            return BAD_PARAMETER;
+        }
+        *field->destination = get_Bit_Range_64(value, field->msb, field->lsb);
+    }
+    return SUCCESS;
+}
+
+void get_Bit_Fields_64(uint64_t value, const uint64_t *fieldMasks, uint64_t *fieldValues, size_t fieldCount)
+{
+    if (!fieldMasks || !fieldValues)
+    {
+        return;
+    }
+    for (size_t fieldIter = 0; fieldIter < fieldCount; ++fieldIter)
+    {
+#if defined (OPENSEA_BMI2)
+        fieldValues[fieldIter] = _pext_u64(value, fieldMasks[fieldIter]);
+#else
+        uint64_t mask = fieldMasks[fieldIter];
+        uint64_t fieldValue = 0;
+        if (mask)
+        {
+            uint8_t lowBit = lowest_Set_Bit_64(mask);
+            uint64_t shiftedMask = mask >> lowBit;
+            if ((shiftedMask & (shiftedMask + 1)) == 0)
+            {
+                //contiguous range of bits, so a shift and mask is all that is needed
+                fieldValue = (value >> lowBit) & shiftedMask;
+            }
+            else
+            {
+                //scattered bits. Pack each one in from lowest to highest
+                uint8_t outputBit = 0;
+                while (mask)
+                {
+                    uint64_t lowestBit = mask & (~mask + 1);
+                    if (value & lowestBit)
+                    {
+                        fieldValue |= UINT64_C(1) << outputBit;
+                    }
+                    ++outputBit;
+                    mask &= mask - 1;
+                }
+            }
+        }
+        fieldValues[fieldIter] = fieldValue;
+#endif
+    }
+}
+
 int16_t celsius_To_Fahrenheit(int16_t *celsius)
 {
     int16_t fahrenheit = 0;
@@ -152,776 +485,2756 @@ int16_t kelvin_To_Fahrenheit(int16_t *kelvin)
 //use this to swap the bytes in a string...useful for ATA strings
 void byte_Swap_String(char *stringToChange)
 {
-    uint32_t stringIter = 0;
-    size_t   stringlen = strlen(stringToChange);
-    char *swappedString = (char *)calloc(stringlen, sizeof(char));
-    if (swappedString == NULL)
+    size_t stringIter = 0;
+    size_t stringlen = 0;
+    if (stringToChange == NULL)
     {
         return;
     }
-    memset(swappedString, 0, stringlen);
-    if (stringlen > 0)
+    stringlen = strlen(stringToChange);
+    for (stringIter = 0; stringIter + 1 < stringlen; stringIter += 2)
+    {
+        char temp = stringToChange[stringIter];
+        stringToChange[stringIter] = stringToChange[stringIter + 1];
+        stringToChange[stringIter + 1] = temp;
+    }
+    if (stringIter < stringlen)
+    {
+        //odd length string. The last character would be swapped with the null terminator, so it gets dropped
+        stringToChange[stringIter] = '\0';
+    }
+}
+
+size_t byte_Swap_And_Trim_ATA_String(char *ataString, size_t stringLength)
+{
+    size_t iter = 0;
+    size_t firstChar = SIZE_MAX;//first character that isn't a space after swapping and sanitizing
+    size_t lastChar = 0;//last character that isn't a space after swapping and sanitizing
+    size_t newLength = 0;
+    if (ataString == NULL || stringLength == 0)
+    {
+        return 0;
+    }
+#if defined (OPENSEA_SIMD_SSE2)
+    const __m128i spaces = _mm_set1_epi8(' ');
+    const __m128i lastPrintable = _mm_set1_epi8('~');
+    for (; iter + 16 <= stringLength; iter += 16)
+    {
+        __m128i chars = _mm_loadu_si128((const __m128i*)&ataString[iter]);
+        uint32_t notSpaceMask = 0;
+        //swap the bytes in each word
+        chars = _mm_or_si128(_mm_slli_epi16(chars, 8), _mm_srli_epi16(chars, 8));
+        //anything outside of ' ' to '~' becomes a space
+        __m128i printable = _mm_and_si128(_mm_cmpeq_epi8(_mm_max_epu8(chars, spaces), chars), _mm_cmpeq_epi8(_mm_min_epu8(chars, lastPrintable), chars));
+        chars = _mm_or_si128(_mm_and_si128(printable, chars), _mm_andnot_si128(printable, spaces));
+        _mm_storeu_si128((__m128i*)&ataString[iter], chars);
+        notSpaceMask = (uint32_t)(~_mm_movemask_epi8(_mm_cmpeq_epi8(chars, spaces))) & UINT32_C(0xFFFF);
+        if (notSpaceMask)
+        {
+            if (firstChar == SIZE_MAX)
+            {
+                firstChar = iter + lowest_Set_Bit_32(notSpaceMask);
+            }
+            lastChar = iter + highest_Set_Bit_32(notSpaceMask);
+        }
+    }
+#endif
+    for (; iter < stringLength; iter += 2)
     {
-        for (stringIter = 0; stringIter < stringlen; stringIter += 2)
+        size_t pairIter = 0;
+        if (iter + 1 < stringLength)
+        {
+            char temp = ataString[iter];
+            ataString[iter] = ataString[iter + 1];
+            ataString[iter + 1] = temp;
+        }
+        for (pairIter = iter; pairIter < iter + 2 && pairIter < stringLength; ++pairIter)
         {
-            swappedString[stringIter] = stringToChange[stringIter + 1];
-            if (stringIter + 1 < stringlen)
+            if (ataString[pairIter] < ' ' || ataString[pairIter] > '~')
+            {
+                ataString[pairIter] = ' ';
+            }
+            else if (ataString[pairIter] != ' ')
             {
-                swappedString[stringIter + 1] = stringToChange[stringIter];
+                if (firstChar == SIZE_MAX)
+                {
+                    firstChar = pairIter;
+                }
+                lastChar = pairIter;
             }
         }
     }
-    strncpy(stringToChange, swappedString, stringlen);
-    free(swappedString);
+    if (firstChar != SIZE_MAX)
+    {
+        newLength = lastChar - firstChar + 1;
+        if (firstChar > 0)
+        {
+            memmove(ataString, &ataString[firstChar], newLength);
+        }
+    }
+    memset(&ataString[newLength], 0, stringLength - newLength);
+    return newLength;
 }
-void remove_Whitespace_Left(char *stringToChange)
+
+//Same characters as isspace() in the C locale, but without going through the locale for each character
+M_STATIC_INLINE bool is_ASCII_Whitespace(char character)
 {
-    size_t iter = 0, len = 0;
-    if (stringToChange == NULL)
+    return character == ' ' || (character >= '\t' && character <= '\r');
+}
+
+//Leading whitespace has always been " \t\n\v\f" (no \r), so keep that set for anything removing whitespace from the front of a string
+M_STATIC_INLINE bool is_ASCII_Leading_Whitespace(char character)
+{
+    return character == ' ' || (character >= '\t' && character <= '\f');
+}
+
+#if defined (OPENSEA_SIMD_SSE2)
+//returns a mask with a bit set for each of the 16 characters that is not whitespace
+//lastControlChar is '\r' for the isspace() set or '\f' for the leading whitespace set
+M_STATIC_INLINE uint32_t not_Whitespace_Mask_SSE2(__m128i chars, char lastControlChar)
+{
+    //'\t' through '\r' are 9 - 13, so subtracting 9 leaves them as 0 - 4 and everything else is above 4 as an unsigned byte
+    __m128i controlChars = _mm_sub_epi8(chars, _mm_set1_epi8('\t'));
+    __m128i whitespace = _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(_mm_min_epu8(controlChars, _mm_set1_epi8((char)(lastControlChar - '\t'))), controlChars));
+    return (uint32_t)(~_mm_movemask_epi8(whitespace)) & UINT32_C(0xFFFF);
+}
+#endif
+
+//returns the offset of the first character that is not leading whitespace (see is_ASCII_Leading_Whitespace), or stringLength if it is all whitespace
+static size_t find_First_Non_Whitespace(const char *string, size_t stringLength)
+{
+    size_t iter = 0;
+#if defined (OPENSEA_SIMD_SSE2)
+    for (; iter + 16 <= stringLength; iter += 16)
     {
-        return;
+        uint32_t notWhitespace = not_Whitespace_Mask_SSE2(_mm_loadu_si128((const __m128i*)&string[iter]), '\f');
+        if (notWhitespace)
+        {
+            return iter + lowest_Set_Bit_32(notWhitespace);
+        }
     }
-    len = strspn(stringToChange, " \t\n\v\f"); //only touch spaces at the beginning of the string, not the whole string
-    if (len == 0)
+#endif
+    while (iter < stringLength && is_ASCII_Leading_Whitespace(string[iter]))
     {
-        return;
+        ++iter;
     }
+    return iter;
+}
 
-    while ((stringToChange[iter]) && iter < (strlen(stringToChange) - 1))  // having issues with the isspace command leaving extra chars in the string
+//returns the length of the string once trailing whitespace is removed (offset of the last character that is not whitespace + 1)
+static size_t find_End_Of_Non_Whitespace(const char *string, size_t stringLength)
+{
+    size_t iter = stringLength;
+#if defined (OPENSEA_SIMD_SSE2)
+    for (; iter >= 16; iter -= 16)
     {
-        stringToChange[iter] = stringToChange[iter + len];
-        iter++;
+        uint32_t notWhitespace = not_Whitespace_Mask_SSE2(_mm_loadu_si128((const __m128i*)&string[iter - 16]), '\r');
+        if (notWhitespace)
+        {
+            return iter - 16 + highest_Set_Bit_32(notWhitespace) + 1;
+        }
+    }
+#endif
+    while (iter > 0 && is_ASCII_Whitespace(string[iter - 1]))
+    {
+        --iter;
     }
+    return iter;
 }
-void remove_Trailing_Whitespace(char *stringToChange)
+
+size_t remove_Trailing_Whitespace_Len(char *stringToChange, size_t stringLength)
 {
-    size_t iter = 0;
+    size_t newLength = 0;
     if (stringToChange == NULL)
     {
-        return;
+        return 0;
     }
-    iter = (strlen(stringToChange));
-    if (iter == -1)
+    newLength = find_End_Of_Non_Whitespace(stringToChange, stringLength);
+    if (newLength < stringLength)
     {
-        return;
+        stringToChange[newLength] = '\0';
+    }
+    return newLength;
+}
+
+size_t remove_Leading_Whitespace_Len(char *stringToChange, size_t stringLength)
+{
+    size_t leadingWhitespace = 0, newLength = 0;
+    if (stringToChange == NULL)
+    {
+        return 0;
     }
-    while (iter > 0 && isspace(stringToChange[iter - 1]))
+    leadingWhitespace = find_First_Non_Whitespace(stringToChange, stringLength);
+    if (leadingWhitespace == 0)
     {
-        stringToChange[iter - 1] = '\0'; //replace spaces with NULL terminators
-        iter--;
+        return stringLength;
     }
+    newLength = stringLength - leadingWhitespace;
+    memmove(stringToChange, &stringToChange[leadingWhitespace], newLength);
+    stringToChange[newLength] = '\0';
+    return newLength;
 }
 
-void remove_Leading_Whitespace(char *stringToChange)
+size_t remove_Leading_And_Trailing_Whitespace_Len(char *stringToChange, size_t stringLength)
 {
-    size_t iter = 0, len = 0, stringToChangeLen = 0;
+    size_t leadingWhitespace = 0, endOfString = 0, newLength = 0;
     if (stringToChange == NULL)
     {
-        return;
+        return 0;
     }
-    stringToChangeLen = strlen(stringToChange);
-    len = strspn(stringToChange, " \t\n\v\f"); //only touch spaces at the beginning of the string, not the whole string
-    if (len == 0)
+    leadingWhitespace = find_First_Non_Whitespace(stringToChange, stringLength);
+    if (leadingWhitespace < stringLength)
     {
-        return;
+        endOfString = find_End_Of_Non_Whitespace(stringToChange, stringLength);
+    }
+    //leading stops at \r but trailing does not, so a string like " \r " leaves nothing
+    if (leadingWhitespace < endOfString)
+    {
+        newLength = endOfString - leadingWhitespace;
+        if (leadingWhitespace > 0)
+        {
+            memmove(stringToChange, &stringToChange[leadingWhitespace], newLength);
+        }
     }
-    while (isspace(stringToChange[iter]) && iter < (stringToChangeLen - len))
+    if (newLength < stringLength)
     {
-        stringToChange[iter] = stringToChange[iter + len];
-        stringToChange[iter + len] = 0;
-        iter++;
+        stringToChange[newLength] = '\0';
     }
+    return newLength;
 }
 
-void remove_Leading_And_Trailing_Whitespace(char *stringToChange)
+void remove_Whitespace_Left(char *stringToChange)
 {
-    remove_Leading_Whitespace(stringToChange);
-    remove_Trailing_Whitespace(stringToChange);
+    if (stringToChange == NULL)
+    {
+        return;
+    }
+    remove_Leading_Whitespace_Len(stringToChange, strlen(stringToChange));
 }
 
-void convert_String_To_Upper_Case(char *stringToChange)
+void remove_Trailing_Whitespace(char *stringToChange)
 {
-    size_t stringLen = 0, iter = 0;
     if (stringToChange == NULL)
     {
         return;
     }
-    stringLen = strlen(stringToChange);
-    if (stringLen == 0)
+    remove_Trailing_Whitespace_Len(stringToChange, strlen(stringToChange));
+}
+
+void remove_Leading_Whitespace(char *stringToChange)
+{
+    if (stringToChange == NULL)
     {
         return;
     }
-    while (iter <= stringLen)
-    {
-        stringToChange[iter] = (char)toupper(stringToChange[iter]);
-        iter++;
-    }
+    remove_Leading_Whitespace_Len(stringToChange, strlen(stringToChange));
 }
 
-void convert_String_To_Lower_Case(char *stringToChange)
+void remove_Leading_And_Trailing_Whitespace(char *stringToChange)
 {
-    size_t stringLen = 0, iter = 0;
     if (stringToChange == NULL)
     {
         return;
     }
-    stringLen = strlen(stringToChange);
-    if (stringLen == 0)
+    remove_Leading_And_Trailing_Whitespace_Len(stringToChange, strlen(stringToChange));
+}
+
+#if defined (OPENSEA_SIMD_SSE2)
+//flips the case of every character in 16 bytes that falls between rangeStart and rangeStart + 25 ('a' - 'z' or 'A' - 'Z')
+M_STATIC_INLINE __m128i ascii_Case_Convert_SSE2(__m128i chars, char rangeStart)
+{
+    //move the range to the bottom of the signed 8bit range so that one signed compare checks both ends of it
+    __m128i shifted = _mm_add_epi8(chars, _mm_set1_epi8((char)(-128 - rangeStart)));
+    __m128i inRange = _mm_cmplt_epi8(shifted, _mm_set1_epi8(-128 + 26));
+    return _mm_xor_si128(chars, _mm_and_si128(inRange, _mm_set1_epi8(0x20)));
+}
+#elif defined (OPENSEA_SIMD_NEON)
+M_STATIC_INLINE uint8x16_t ascii_Case_Convert_NEON(uint8x16_t chars, char rangeStart)
+{
+    uint8x16_t inRange = vandq_u8(vcgeq_u8(chars, vdupq_n_u8((uint8_t)rangeStart)), vcleq_u8(chars, vdupq_n_u8((uint8_t)(rangeStart + 25))));
+    return veorq_u8(chars, vandq_u8(inRange, vdupq_n_u8(0x20)));
+}
+#endif
+
+//Converts length characters from source into destination (which may be the same buffer), flipping the case of characters between rangeStart and rangeStart + 25.
+//Only ASCII letters are changed, so this does not depend on the current locale.
+static void ascii_Case_Convert(char *destination, const char *source, size_t length, char rangeStart)
+{
+    size_t iter = 0;
+#if defined (OPENSEA_SIMD_SSE2)
+    for (; iter + 16 <= length; iter += 16)
     {
-        return;
+        __m128i chars = _mm_loadu_si128((const __m128i*)&source[iter]);
+        _mm_storeu_si128((__m128i*)&destination[iter], ascii_Case_Convert_SSE2(chars, rangeStart));
+    }
+#elif defined (OPENSEA_SIMD_NEON)
+    for (; iter + 16 <= length; iter += 16)
+    {
+        uint8x16_t chars = vld1q_u8((const uint8_t*)&source[iter]);
+        vst1q_u8((uint8_t*)&destination[iter], ascii_Case_Convert_NEON(chars, rangeStart));
     }
-    while (iter <= stringLen)
+#endif
+    for (; iter < length; ++iter)
     {
-        stringToChange[iter] = (char)tolower(stringToChange[iter]);
-        iter++;
+        char character = source[iter];
+        if (character >= rangeStart && character <= (char)(rangeStart + 25))
+        {
+            character ^= 0x20;
+        }
+        destination[iter] = character;
     }
 }
 
-void print_Return_Enum(char *funcName, int ret)
+void convert_String_To_Upper_Case(char *stringToChange)
 {
-    if (VERBOSITY_COMMAND_NAMES > g_verbosity) //no printing for default or quiet
+    if (stringToChange == NULL)
     {
         return;
     }
+    ascii_Case_Convert(stringToChange, stringToChange, strlen(stringToChange), 'a');
+}
 
-    if (NULL == funcName)
-    {
-        printf("Unknown funtion returning: ");
-    }
-    else
+void convert_String_To_Lower_Case(char *stringToChange)
+{
+    if (stringToChange == NULL)
     {
-        printf("%s returning: ", funcName);
+        return;
     }
+    ascii_Case_Convert(stringToChange, stringToChange, strlen(stringToChange), 'A');
+}
 
-    switch (ret)
+void convert_String_To_Upper_Case_Len(char *stringToChange, size_t stringLength)
+{
+    if (stringToChange == NULL)
     {
-    case SUCCESS:
-        printf("SUCCESS\n");
-        break;
-    case FAILURE:
-        printf("FAILURE\n");
-        break;
-    case NOT_SUPPORTED:
-        printf("NOT SUPPORTED\n");
-        break;
-    case COMMAND_FAILURE:
-        printf("COMMAND FAILURE\n");
-        break;
-    case IN_PROGRESS:
-        printf("IN PROGRESS\n");
-        break;
-    case ABORTED:
-        printf("ABORTED\n");
-        break;
-    case BAD_PARAMETER:
-        printf("BAD PARAMETER\n");
-        break;
-    case MEMORY_FAILURE:
-        printf("MEMORY FAILURE\n");
-        break;
-    case OS_PASSTHROUGH_FAILURE:
-        printf("OS PASSTHROUGH FAILURE\n");
-        break;
-    case LIBRARY_MISMATCH:
-        printf("LIBRARY MISMATCH\n");
-        break;
-	case FROZEN:
-		printf("FROZEN\n");
-		break;
-	case PERMISSION_DENIED:
-	    printf("PERMISSION DENIED\n");
-	    break;
-    case FILE_OPEN_ERROR:
-        printf("FILE OPEN ERROR\n");
-        break;
-    case WARN_INCOMPLETE_RFTRS:
-        printf("WARNING INCOMPLETE RTFRS\n");
-        break;
-    case COMMAND_TIMEOUT:
-        printf("COMMAND TIMEOUT\n");
+        return;
+    }
+    ascii_Case_Convert(stringToChange, stringToChange, stringLength, 'a');
+}
+
+void convert_String_To_Lower_Case_Len(char *stringToChange, size_t stringLength)
+{
+    if (stringToChange == NULL)
+    {
+        return;
+    }
+    ascii_Case_Convert(stringToChange, stringToChange, stringLength, 'A');
+}
+
+void copy_String_To_Upper_Case(char *destination, const char *source, size_t stringLength)
+{
+    if (destination == NULL || source == NULL)
+    {
+        return;
+    }
+    ascii_Case_Convert(destination, source, stringLength, 'a');
+    destination[stringLength] = '\0';
+}
+
+void copy_String_To_Lower_Case(char *destination, const char *source, size_t stringLength)
+{
+    if (destination == NULL || source == NULL)
+    {
+        return;
+    }
+    ascii_Case_Convert(destination, source, stringLength, 'A');
+    destination[stringLength] = '\0';
+}
+
+int compare_String_Case_Insensitive(const char *string1, const char *string2, size_t length)
+{
+    size_t iter = 0;
+    if (string1 == NULL || string2 == NULL)
+    {
+        return string1 == string2 ? 0 : (string1 == NULL ? -1 : 1);
+    }
+#if defined (OPENSEA_SIMD_SSE2)
+    for (; iter + 16 <= length; iter += 16)
+    {
+        __m128i chars1 = ascii_Case_Convert_SSE2(_mm_loadu_si128((const __m128i*)&string1[iter]), 'A');
+        __m128i chars2 = ascii_Case_Convert_SSE2(_mm_loadu_si128((const __m128i*)&string2[iter]), 'A');
+        uint32_t differentMask = (uint32_t)(~_mm_movemask_epi8(_mm_cmpeq_epi8(chars1, chars2))) & UINT32_C(0xFFFF);
+        if (differentMask)
+        {
+            //fall through to the byte by byte loop starting at the first difference to get the return value
+            iter += lowest_Set_Bit_32(differentMask);
+            break;
+        }
+    }
+#endif
+    for (; iter < length; ++iter)
+    {
+        uint8_t char1 = (uint8_t)string1[iter];
+        uint8_t char2 = (uint8_t)string2[iter];
+        if (char1 >= 'A' && char1 <= 'Z')
+        {
+            char1 ^= 0x20;
+        }
+        if (char2 >= 'A' && char2 <= 'Z')
+        {
+            char2 ^= 0x20;
+        }
+        if (char1 != char2)
+        {
+            return char1 < char2 ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+static const char *returnEnumStrings[] =
+{
+    "SUCCESS",                              //SUCCESS
+    "FAILURE",                              //FAILURE
+    "NOT SUPPORTED",                        //NOT_SUPPORTED
+    "COMMAND FAILURE",                      //COMMAND_FAILURE
+    "IN PROGRESS",                          //IN_PROGRESS
+    "ABORTED",                              //ABORTED
+    "BAD PARAMETER",                        //BAD_PARAMETER
+    "MEMORY FAILURE",                       //MEMORY_FAILURE
+    "OS PASSTHROUGH FAILURE",               //OS_PASSTHROUGH_FAILURE
+    "LIBRARY MISMATCH",                     //LIBRARY_MISMATCH
+    "FROZEN",                               //FROZEN
+    "PERMISSION DENIED",                    //PERMISSION_DENIED
+    "FILE OPEN ERROR",                      //FILE_OPEN_ERROR
+    "WARNING INCOMPLETE RTFRS",             //WARN_INCOMPLETE_RFTRS
+    "COMMAND TIMEOUT",                      //COMMAND_TIMEOUT
+    "WARNING NOT ALL DEVICES ENUMERATED",   //WARN_NOT_ALL_DEVICES_ENUMERATED
+    "WARN INVALID CHECKSUM",                //WARN_INVALID_CHECKSUM
+    "OS COMMAND NOT AVAILABLE",             //OS_COMMAND_NOT_AVAILABLE
+    "OS COMMAND BLOCKED",                   //OS_COMMAND_BLOCKED
+};
+M_STATIC_ASSERT(sizeof(returnEnumStrings) / sizeof(returnEnumStrings[0]) == UNKNOWN, returnEnumStrings_matches_eReturnValues);
+
+const char* get_Return_Enum_String(int ret)
+{
+    if (ret >= 0 && (size_t)ret < sizeof(returnEnumStrings) / sizeof(returnEnumStrings[0]))
+    {
+        return returnEnumStrings[ret];
+    }
+    return "UNKNOWN";
+}
+
+void print_Return_Enum(char *funcName, int ret)
+{
+    if (VERBOSITY_COMMAND_NAMES > g_verbosity) //no printing for default or quiet
+    {
+        return;
+    }
+
+    if (NULL == funcName)
+    {
+        printf("Unknown funtion returning: ");
+    }
+    else
+    {
+        printf("%s returning: ", funcName);
+    }
+
+    if (ret >= 0 && (size_t)ret < sizeof(returnEnumStrings) / sizeof(returnEnumStrings[0]))
+    {
+        printf("%s\n", returnEnumStrings[ret]);
+    }
+    else
+    {
+        printf("UNKNOWN: %d\n", ret);
+    }
+    printf("\n");
+}
+
+//"\n  0x" + 16 offset digits + " " + 16 * "XX " + "  " + 16 ASCII characters, rounded up
+#define HEX_DUMP_MAX_LINE_LENGTH 128
+
+static void hex_Dump_Writer_Init(hexDumpWriter *writer, eHexDumpOutputType outputType)
+{
+    writer->outputType = outputType;
+    writer->outputFile = NULL;
+    writer->outputFD = -1;
+    writer->outputBuffer = NULL;
+    writer->outputBufferSize = 0;
+    writer->outputLength = 0;
+    writer->outputError = false;
+    writer->blockLength = 0;
+}
+
+static void hex_Dump_Flush(hexDumpWriter *writer)
+{
+    const char *data = writer->block;
+    size_t remaining = writer->blockLength;
+    if (writer->outputError)
+    {
+        //no output (NULL file, bad descriptor) or a write already failed. Drop the text instead of writing to an invalid file.
+        writer->blockLength = 0;
+        return;
+    }
+    if (remaining == 0)
+    {
+        return;
+    }
+    switch (writer->outputType)
+    {
+    case HEX_DUMP_OUTPUT_FILE:
+        if (remaining != fwrite(data, 1, remaining, writer->outputFile))
+        {
+            writer->outputError = true;
+        }
         break;
-    case WARN_NOT_ALL_DEVICES_ENUMERATED:
-        printf("WARNING NOT ALL DEVICES ENUMERATED\n");
+    case HEX_DUMP_OUTPUT_FD:
+        while (remaining > 0 && !writer->outputError)
+        {
+#if defined (_WIN32)
+            int written = _write(writer->outputFD, data, (unsigned int)M_Min(remaining, INT32_MAX));
+#else
+            ssize_t written = write(writer->outputFD, data, remaining);
+#endif
+            if (written < 0)
+            {
+                if (errno != EINTR)
+                {
+                    writer->outputError = true;
+                }
+                continue;
+            }
+            data += written;
+            remaining -= (size_t)written;
+        }
         break;
-    case WARN_INVALID_CHECKSUM:
-        printf("WARN INVALID CHECKSUM\n");
+    case HEX_DUMP_OUTPUT_BUFFER:
+        //keep room for the null terminator. Anything past the end of the buffer is only counted.
+        if (writer->outputBufferSize > 0 && writer->outputLength < writer->outputBufferSize - 1)
+        {
+            size_t copyLength = (size_t)M_Min((uint64_t)remaining, writer->outputBufferSize - 1 - writer->outputLength);
+            memcpy(&writer->outputBuffer[writer->outputLength], data, copyLength);
+        }
         break;
-    case OS_COMMAND_NOT_AVAILABLE:
-        printf("OS COMMAND NOT AVAILABLE\n");
+    }
+    writer->outputLength += writer->blockLength;
+    writer->blockLength = 0;
+}
+
+//returns a pointer to at least HEX_DUMP_MAX_LINE_LENGTH characters of free space in the block, flushing it first if needed.
+static char* hex_Dump_Reserve_Line(hexDumpWriter *writer)
+{
+    if (writer->blockLength + HEX_DUMP_MAX_LINE_LENGTH > HEX_DUMP_BLOCK_SIZE)
+    {
+        hex_Dump_Flush(writer);
+    }
+    return &writer->block[writer->blockLength];
+}
+
+static void hex_Dump_Append(hexDumpWriter *writer, const char *text, size_t length)
+{
+    while (length > 0)
+    {
+        size_t copyLength = M_Min(length, HEX_DUMP_BLOCK_SIZE - writer->blockLength);
+        memcpy(&writer->block[writer->blockLength], text, copyLength);
+        writer->blockLength += copyLength;
+        text += copyLength;
+        length -= copyLength;
+        if (writer->blockLength == HEX_DUMP_BLOCK_SIZE)
+        {
+            hex_Dump_Flush(writer);
+        }
+    }
+}
+
+//finishes writing everything out. Buffer output is null terminated.
+static void hex_Dump_Writer_Finish(hexDumpWriter *writer)
+{
+    hex_Dump_Flush(writer);
+    switch (writer->outputType)
+    {
+    case HEX_DUMP_OUTPUT_FILE:
+        if (!writer->outputError && 0 != fflush(writer->outputFile))
+        {
+            writer->outputError = true;
+        }
         break;
-    case OS_COMMAND_BLOCKED:
-        printf("OS COMMAND BLOCKED\n");
+    case HEX_DUMP_OUTPUT_BUFFER:
+        if (writer->outputBufferSize > 0)
+        {
+            writer->outputBuffer[M_Min(writer->outputLength, writer->outputBufferSize - 1)] = '\0';
+        }
         break;
-    default:
-		printf("UNKNOWN: %d\n", ret);
+    case HEX_DUMP_OUTPUT_FD:
         break;
     }
-    printf("\n");
 }
 
-void print_Data_Buffer(uint8_t *dataBuffer, uint32_t bufferLen, bool showPrint)
+//Offsets are printed with 2, 4, 6 or 8 (up to 16 for 64bit lengths) hex digits depending on how large the buffer is so that all the offsets line up.
+static uint8_t hex_Dump_Offset_Width(uint64_t length)
+{
+    uint8_t offsetWidth = 2;
+    while (offsetWidth < 16 && (length >> (offsetWidth * 4)) > 0)
+    {
+        offsetWidth += 2;
+    }
+    return offsetWidth;
+}
+
+//writes the column header line: "\n" + room for the offset + "0  1  2  ...  F  " (only as many columns as there are bytes, up to 16)
+static void hex_Dump_Write_Header(hexDumpWriter *writer, uint8_t offsetWidth, uint64_t length)
+{
+    char *line = hex_Dump_Reserve_Line(writer);
+    char *iter = line;
+    uint8_t columns = (uint8_t)M_Min(length, 16);
+    *iter++ = '\n';
+    //we print out 2 (0x) + offset width + 2 (spaces) + 2 (leading spaces on each line) then the offsets
+    memset(iter, ' ', (size_t)offsetWidth + 6);
+    iter += offsetWidth + 6;
+    for (uint8_t columnIter = 0; columnIter < columns; ++columnIter)
+    {
+        iter[0] = hexDigitPairs[columnIter * 2 + 1];
+        iter[1] = ' ';
+        iter[2] = ' ';
+        iter += 3;
+    }
+    writer->blockLength += (size_t)(iter - line);
+}
+
+//writes "XX " for each of 16 bytes (48 characters)
+static void hex_Dump_Bytes_16(char *output, const uint8_t *data)
+{
+#if defined (OPENSEA_SIMD_SSE2)
+    __m128i bytes = _mm_loadu_si128((const __m128i*)data);
+    __m128i highNibbles = _mm_and_si128(_mm_srli_epi16(bytes, 4), _mm_set1_epi8(0x0F));
+    __m128i lowNibbles = _mm_and_si128(bytes, _mm_set1_epi8(0x0F));
+    #if defined (OPENSEA_SIMD_SSSE3)
+    const __m128i hexCharacters = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F');
+    __m128i highChars = _mm_shuffle_epi8(hexCharacters, highNibbles);
+    __m128i lowChars = _mm_shuffle_epi8(hexCharacters, lowNibbles);
+    #else
+    //'0' + nibble, plus 7 more for A-F
+    __m128i highChars = _mm_add_epi8(_mm_add_epi8(highNibbles, _mm_set1_epi8('0')), _mm_and_si128(_mm_cmpgt_epi8(highNibbles, _mm_set1_epi8(9)), _mm_set1_epi8(7)));
+    __m128i lowChars = _mm_add_epi8(_mm_add_epi8(lowNibbles, _mm_set1_epi8('0')), _mm_and_si128(_mm_cmpgt_epi8(lowNibbles, _mm_set1_epi8(9)), _mm_set1_epi8(7)));
+    #endif
+    __m128i firstHalf = _mm_unpacklo_epi8(highChars, lowChars);//hex characters for bytes 0 - 7
+    __m128i secondHalf = _mm_unpackhi_epi8(highChars, lowChars);//hex characters for bytes 8 - 15
+    #if defined (OPENSEA_SIMD_SSSE3)
+    //spread each pair of hex characters out to 3 characters and fill in the spaces. Shuffle indexes with the high bit set produce zero.
+    const char z = (char)0x80;
+    __m128i output0 = _mm_shuffle_epi8(firstHalf, _mm_setr_epi8(0, 1, z, 2, 3, z, 4, 5, z, 6, 7, z, 8, 9, z, 10));
+    __m128i output1 = _mm_or_si128(_mm_shuffle_epi8(firstHalf, _mm_setr_epi8(11, z, 12, 13, z, 14, 15, z, z, z, z, z, z, z, z, z)), _mm_shuffle_epi8(secondHalf, _mm_setr_epi8(z, z, z, z, z, z, z, z, 0, 1, z, 2, 3, z, 4, 5)));
+    __m128i output2 = _mm_shuffle_epi8(secondHalf, _mm_setr_epi8(z, 6, 7, z, 8, 9, z, 10, 11, z, 12, 13, z, 14, 15, z));
+    output0 = _mm_or_si128(output0, _mm_setr_epi8(0, 0, ' ', 0, 0, ' ', 0, 0, ' ', 0, 0, ' ', 0, 0, ' ', 0));
+    output1 = _mm_or_si128(output1, _mm_setr_epi8(0, ' ', 0, 0, ' ', 0, 0, ' ', 0, 0, ' ', 0, 0, ' ', 0, 0));
+    output2 = _mm_or_si128(output2, _mm_setr_epi8(' ', 0, 0, ' ', 0, 0, ' ', 0, 0, ' ', 0, 0, ' ', 0, 0, ' '));
+    _mm_storeu_si128((__m128i*)&output[0], output0);
+    _mm_storeu_si128((__m128i*)&output[16], output1);
+    _mm_storeu_si128((__m128i*)&output[32], output2);
+    #else
+    char hexChars[32];
+    _mm_storeu_si128((__m128i*)&hexChars[0], firstHalf);
+    _mm_storeu_si128((__m128i*)&hexChars[16], secondHalf);
+    for (uint8_t byteIter = 0; byteIter < 16; ++byteIter)
+    {
+        output[byteIter * 3] = hexChars[byteIter * 2];
+        output[byteIter * 3 + 1] = hexChars[byteIter * 2 + 1];
+        output[byteIter * 3 + 2] = ' ';
+    }
+    #endif
+#elif defined (OPENSEA_SIMD_NEON)
+    uint8x16_t bytes = vld1q_u8(data);
+    uint8x16_t highNibbles = vshrq_n_u8(bytes, 4);
+    uint8x16_t lowNibbles = vandq_u8(bytes, vdupq_n_u8(0x0F));
+    uint8x16x3_t hexTriples;
+    hexTriples.val[0] = vaddq_u8(vaddq_u8(highNibbles, vdupq_n_u8('0')), vandq_u8(vcgtq_u8(highNibbles, vdupq_n_u8(9)), vdupq_n_u8(7)));
+    hexTriples.val[1] = vaddq_u8(vaddq_u8(lowNibbles, vdupq_n_u8('0')), vandq_u8(vcgtq_u8(lowNibbles, vdupq_n_u8(9)), vdupq_n_u8(7)));
+    hexTriples.val[2] = vdupq_n_u8(' ');
+    //interleaving store writes high digit, low digit, space for each byte
+    vst3q_u8((uint8_t*)output, hexTriples);
+#else
+    for (uint8_t byteIter = 0; byteIter < 16; ++byteIter)
+    {
+        output[byteIter * 3] = hexDigitPairs[data[byteIter] * 2];
+        output[byteIter * 3 + 1] = hexDigitPairs[data[byteIter] * 2 + 1];
+        output[byteIter * 3 + 2] = ' ';
+    }
+#endif
+}
+
+//writes the printable translation of 16 bytes. Anything that is not printable ASCII (0x20 - 0x7E) becomes '.'
+static void hex_Dump_ASCII_16(char *output, const uint8_t *data)
+{
+#if defined (OPENSEA_SIMD_SSE2)
+    __m128i bytes = _mm_loadu_si128((const __m128i*)data);
+    //move 0x20 - 0x7E to the bottom of the signed range so that one signed compare checks both ends
+    __m128i printable = _mm_cmplt_epi8(_mm_add_epi8(bytes, _mm_set1_epi8(0x60)), _mm_set1_epi8(-128 + 0x5F));
+    __m128i result = _mm_or_si128(_mm_and_si128(printable, bytes), _mm_andnot_si128(printable, _mm_set1_epi8('.')));
+    _mm_storeu_si128((__m128i*)output, result);
+#elif defined (OPENSEA_SIMD_NEON)
+    uint8x16_t bytes = vld1q_u8(data);
+    uint8x16_t printable = vandq_u8(vcgeq_u8(bytes, vdupq_n_u8(0x20)), vcleq_u8(bytes, vdupq_n_u8(0x7E)));
+    vst1q_u8((uint8_t*)output, vbslq_u8(printable, bytes, vdupq_n_u8('.')));
+#else
+    for (uint8_t byteIter = 0; byteIter < 16; ++byteIter)
+    {
+        output[byteIter] = (data[byteIter] >= 0x20 && data[byteIter] <= 0x7E) ? (char)data[byteIter] : '.';
+    }
+#endif
+}
+
+//writes one line of the dump: "\n  0x<offset> " then "XX " for each byte. With showPrint, partial lines are padded out so the ASCII column lines up.
+static void hex_Dump_Write_Line(hexDumpWriter *writer, uint64_t offset, uint8_t offsetWidth, const uint8_t *data, size_t count, bool showPrint)
+{
+    char *line = hex_Dump_Reserve_Line(writer);
+    char *iter = line;
+    char offsetDigits[16];
+    size_t offsetDigitCount = uint64_To_Hex_Digits(offset, offsetDigits, offsetWidth);
+    memcpy(iter, "\n  0x", 5);
+    iter += 5;
+    memcpy(iter, &offsetDigits[16 - offsetDigitCount], offsetDigitCount);
+    iter += offsetDigitCount;
+    *iter++ = ' ';
+    if (count == 16)
+    {
+        hex_Dump_Bytes_16(iter, data);
+        iter += 48;
+    }
+    else
+    {
+        for (size_t byteIter = 0; byteIter < count; ++byteIter)
+        {
+            iter[0] = hexDigitPairs[data[byteIter] * 2];
+            iter[1] = hexDigitPairs[data[byteIter] * 2 + 1];
+            iter[2] = ' ';
+            iter += 3;
+        }
+    }
+    if (showPrint)
+    {
+        memset(iter, ' ', (16 - count) * 3 + 2);
+        iter += (16 - count) * 3 + 2;
+        if (count == 16)
+        {
+            hex_Dump_ASCII_16(iter, data);
+        }
+        else
+        {
+            for (size_t byteIter = 0; byteIter < count; ++byteIter)
+            {
+                iter[byteIter] = (data[byteIter] >= 0x20 && data[byteIter] <= 0x7E) ? (char)data[byteIter] : '.';
+            }
+        }
+        iter += count;
+    }
+    writer->blockLength += (size_t)(iter - line);
+}
+
+#if defined (OPENSEA_SIMD_NEON)
+//NEON version of _mm_movemask_epi8 for compare results (each lane is all 0's or all 1's)
+M_STATIC_INLINE uint16_t movemask_NEON(uint8x16_t compareResult)
+{
+    static const uint8_t bitWeights[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+    uint8x16_t bits = vandq_u8(compareResult, vld1q_u8(bitWeights));
+    //add neighboring lanes together until lane 0 has the mask for bytes 0 - 7 and lane 1 has the mask for bytes 8 - 15
+    uint8x8_t sums = vpadd_u8(vget_low_u8(bits), vget_high_u8(bits));
+    sums = vpadd_u8(sums, sums);
+    sums = vpadd_u8(sums, sums);
+    return (uint16_t)(vget_lane_u8(sums, 0) | (vget_lane_u8(sums, 1) << 8));
+}
+#endif
+
+//returns a mask with a bit set for each of the 16 bytes that is different between the two buffers
+static uint16_t compare_16_Bytes(const uint8_t *bufferA, const uint8_t *bufferB)
+{
+#if defined (OPENSEA_SIMD_SSE2)
+    __m128i equal = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)bufferA), _mm_loadu_si128((const __m128i*)bufferB));
+    return (uint16_t)~_mm_movemask_epi8(equal);
+#elif defined (OPENSEA_SIMD_NEON)
+    return movemask_NEON(vmvnq_u8(vceqq_u8(vld1q_u8(bufferA), vld1q_u8(bufferB))));
+#else
+    uint16_t differentMask = 0;
+    for (uint8_t byteIter = 0; byteIter < 16; ++byteIter)
+    {
+        if (bufferA[byteIter] != bufferB[byteIter])
+        {
+            differentMask |= (uint16_t)(1 << byteIter);
+        }
+    }
+    return differentMask;
+#endif
+}
+
+M_STATIC_INLINE uint8_t count_Set_Bits_16(uint16_t value)
+{
+#if defined (__GNUC__) || defined (__clang__)
+    return (uint8_t)__builtin_popcount(value);
+#else
+    uint8_t count = 0;
+    for (; value; value &= (uint16_t)(value - 1))
+    {
+        ++count;
+    }
+    return count;
+#endif
+}
+
+static void hex_Dump_Stream_Init(hexDumpStream *stream, eHexDumpOutputType outputType, uint64_t expectedLength, bool showPrint)
+{
+    hex_Dump_Writer_Init(&stream->writer, outputType);
+    stream->offset = 0;
+    stream->expectedLength = expectedLength;
+    stream->offsetWidth = hex_Dump_Offset_Width(expectedLength == HEX_DUMP_LENGTH_UNKNOWN ? 0 : expectedLength);
+    stream->showPrint = showPrint;
+    stream->headerWritten = false;
+    stream->lineLength = 0;
+    stream->collapseDuplicates = false;
+    stream->previousLineValid = false;
+    stream->collapsing = false;
+}
+
+void hex_Dump_Stream_Set_Collapse_Duplicates(hexDumpStream *stream, bool collapseDuplicates)
+{
+    if (stream)
+    {
+        stream->collapseDuplicates = collapseDuplicates;
+    }
+}
+
+void hex_Dump_Stream_Init_File(hexDumpStream *stream, FILE *outputFile, uint64_t expectedLength, bool showPrint)
+{
+    if (!stream)
+    {
+        return;
+    }
+    hex_Dump_Stream_Init(stream, HEX_DUMP_OUTPUT_FILE, expectedLength, showPrint);
+    stream->writer.outputFile = outputFile;
+    stream->writer.outputError = outputFile == NULL;
+}
+
+void hex_Dump_Stream_Init_FD(hexDumpStream *stream, int fileDescriptor, uint64_t expectedLength, bool showPrint)
+{
+    if (!stream)
+    {
+        return;
+    }
+    hex_Dump_Stream_Init(stream, HEX_DUMP_OUTPUT_FD, expectedLength, showPrint);
+    stream->writer.outputFD = fileDescriptor;
+    stream->writer.outputError = fileDescriptor < 0;
+}
+
+void hex_Dump_Stream_Init_Buffer(hexDumpStream *stream, char *outputBuffer, size_t outputBufferSize, uint64_t expectedLength, bool showPrint)
+{
+    if (!stream)
+    {
+        return;
+    }
+    hex_Dump_Stream_Init(stream, HEX_DUMP_OUTPUT_BUFFER, expectedLength, showPrint);
+    stream->writer.outputBuffer = outputBuffer;
+    stream->writer.outputBufferSize = outputBuffer ? outputBufferSize : 0;
+}
+
+//writes one line at the current offset, widening the offset column first if the offset no longer fits in it.
+//When collapsing duplicates, a full line that matches the previous full line is not printed. The first one in a run prints a "*" line instead.
+static void hex_Dump_Stream_Write_Line(hexDumpStream *stream, const uint8_t *data, size_t count)
+{
+    if (stream->collapseDuplicates && count == 16)
+    {
+        if (stream->previousLineValid && compare_16_Bytes(stream->previousLine, data) == 0)
+        {
+            if (!stream->collapsing)
+            {
+                hex_Dump_Append(&stream->writer, "\n  *", 4);
+                stream->collapsing = true;
+            }
+            stream->offset += 16;
+            return;
+        }
+        memcpy(stream->previousLine, data, 16);
+        stream->previousLineValid = true;
+    }
+    stream->collapsing = false;
+    if (stream->offsetWidth < 16 && (stream->offset >> (stream->offsetWidth * 4)) > 0)
+    {
+        stream->offsetWidth = hex_Dump_Offset_Width(stream->offset);
+    }
+    hex_Dump_Write_Line(&stream->writer, stream->offset, stream->offsetWidth, data, count, stream->showPrint);
+    stream->offset += count;
+}
+
+static void hex_Dump_Stream_Write_Header(hexDumpStream *stream)
+{
+    if (!stream->headerWritten)
+    {
+        hex_Dump_Write_Header(&stream->writer, stream->offsetWidth, stream->expectedLength);
+        stream->headerWritten = true;
+    }
+}
+
+int hex_Dump_Stream_Write(hexDumpStream *stream, const uint8_t *data, uint64_t length)
+{
+    if (!stream || (!data && length > 0))
+    {
+        return BAD_PARAMETER;
+    }
+    hex_Dump_Stream_Write_Header(stream);
+    if (length == 0)
+    {
+        return stream->writer.outputError ? FAILURE : SUCCESS;
+    }
+    //finish off a line left over from the last call first
+    if (stream->lineLength > 0)
+    {
+        uint8_t copyLength = (uint8_t)M_Min(length, (uint64_t)(16 - stream->lineLength));
+        memcpy(&stream->line[stream->lineLength], data, copyLength);
+        stream->lineLength += copyLength;
+        data += copyLength;
+        length -= copyLength;
+        if (stream->lineLength < 16)
+        {
+            return stream->writer.outputError ? FAILURE : SUCCESS;
+        }
+        hex_Dump_Stream_Write_Line(stream, stream->line, 16);
+        stream->lineLength = 0;
+    }
+    for (; length >= 16; data += 16, length -= 16)
+    {
+        hex_Dump_Stream_Write_Line(stream, data, 16);
+    }
+    if (length > 0)
+    {
+        memcpy(stream->line, data, (size_t)length);
+        stream->lineLength = (uint8_t)length;
+    }
+    return stream->writer.outputError ? FAILURE : SUCCESS;
+}
+
+int hex_Dump_Stream_Finish(hexDumpStream *stream)
+{
+    if (!stream)
+    {
+        return BAD_PARAMETER;
+    }
+    hex_Dump_Stream_Write_Header(stream);
+    if (stream->lineLength > 0)
+    {
+        hex_Dump_Stream_Write_Line(stream, stream->line, stream->lineLength);
+        stream->lineLength = 0;
+    }
+    else if (stream->collapsing)
+    {
+        //the last line is never collapsed so that the end offset of the data is always shown
+        stream->offset -= 16;
+        stream->previousLineValid = false;
+        hex_Dump_Stream_Write_Line(stream, stream->previousLine, 16);
+    }
+    hex_Dump_Append(&stream->writer, "\n\n", 2);
+    hex_Dump_Writer_Finish(&stream->writer);
+    return stream->writer.outputError ? FAILURE : SUCCESS;
+}
+
+void print_Data_Buffer(uint8_t *dataBuffer, uint32_t bufferLen, bool showPrint)
+{
+    print_Data_Buffer_To_File(stdout, dataBuffer, bufferLen, showPrint);
+}
+
+void print_Data_Buffer_Collapsed(const uint8_t *dataBuffer, uint64_t bufferLen, bool showPrint)
+{
+    hexDumpStream stream;
+    if (!dataBuffer && bufferLen > 0)
+    {
+        return;
+    }
+    hex_Dump_Stream_Init_File(&stream, stdout, bufferLen, showPrint);
+    hex_Dump_Stream_Set_Collapse_Duplicates(&stream, true);
+    hex_Dump_Stream_Write(&stream, dataBuffer, bufferLen);
+    hex_Dump_Stream_Finish(&stream);
+}
+
+int print_Data_Buffer_To_File(FILE *outputFile, const uint8_t *dataBuffer, uint64_t bufferLen, bool showPrint)
+{
+    hexDumpStream stream;
+    if (!outputFile || (!dataBuffer && bufferLen > 0))
+    {
+        return BAD_PARAMETER;
+    }
+    hex_Dump_Stream_Init_File(&stream, outputFile, bufferLen, showPrint);
+    hex_Dump_Stream_Write(&stream, dataBuffer, bufferLen);
+    return hex_Dump_Stream_Finish(&stream);
+}
+
+int print_Data_Buffer_To_FD(int fileDescriptor, const uint8_t *dataBuffer, uint64_t bufferLen, bool showPrint)
+{
+    hexDumpStream stream;
+    if (fileDescriptor < 0 || (!dataBuffer && bufferLen > 0))
+    {
+        return BAD_PARAMETER;
+    }
+    hex_Dump_Stream_Init_FD(&stream, fileDescriptor, bufferLen, showPrint);
+    hex_Dump_Stream_Write(&stream, dataBuffer, bufferLen);
+    return hex_Dump_Stream_Finish(&stream);
+}
+
+uint64_t format_Data_Buffer(char *outputBuffer, size_t outputBufferSize, const uint8_t *dataBuffer, uint64_t bufferLen, bool showPrint)
+{
+    hexDumpStream stream;
+    if ((!outputBuffer && outputBufferSize > 0) || (!dataBuffer && bufferLen > 0))
+    {
+        return 0;
+    }
+    hex_Dump_Stream_Init_Buffer(&stream, outputBuffer, outputBufferSize, bufferLen, showPrint);
+    hex_Dump_Stream_Write(&stream, dataBuffer, bufferLen);
+    hex_Dump_Stream_Finish(&stream);
+    return stream.writer.outputLength;
+}
+
+//writes a differing line as three lines: the bytes from buffer A with the offset, the bytes from buffer B, and a line marking the bytes that differ with ^^
+static void hex_Dump_Write_Diff_Line(hexDumpWriter *writer, uint64_t offset, uint8_t offsetWidth, const uint8_t *dataA, const uint8_t *dataB, size_t count, uint16_t differentMask)
+{
+    char *line = hex_Dump_Reserve_Line(writer);
+    char *iter = line;
+    char offsetDigits[16];
+    size_t offsetDigitCount = uint64_To_Hex_Digits(offset, offsetDigits, offsetWidth);
+    //A line
+    memcpy(iter, "\n  0x", 5);
+    iter += 5;
+    memcpy(iter, &offsetDigits[16 - offsetDigitCount], offsetDigitCount);
+    iter += offsetDigitCount;
+    memcpy(iter, " A ", 3);
+    iter += 3;
+    if (count == 16)
+    {
+        hex_Dump_Bytes_16(iter, dataA);
+        iter += 48;
+    }
+    else
+    {
+        for (size_t byteIter = 0; byteIter < count; ++byteIter, iter += 3)
+        {
+            iter[0] = hexDigitPairs[dataA[byteIter] * 2];
+            iter[1] = hexDigitPairs[dataA[byteIter] * 2 + 1];
+            iter[2] = ' ';
+        }
+    }
+    writer->blockLength += (size_t)(iter - line);
+    //B line, lined up under the A line
+    line = hex_Dump_Reserve_Line(writer);
+    iter = line;
+    *iter++ = '\n';
+    memset(iter, ' ', offsetDigitCount + 5);
+    iter += offsetDigitCount + 5;
+    memcpy(iter, "B ", 2);
+    iter += 2;
+    if (count == 16)
+    {
+        hex_Dump_Bytes_16(iter, dataB);
+        iter += 48;
+    }
+    else
+    {
+        for (size_t byteIter = 0; byteIter < count; ++byteIter, iter += 3)
+        {
+            iter[0] = hexDigitPairs[dataB[byteIter] * 2];
+            iter[1] = hexDigitPairs[dataB[byteIter] * 2 + 1];
+            iter[2] = ' ';
+        }
+    }
+    writer->blockLength += (size_t)(iter - line);
+    //marker line. Stops after the last difference so there are no trailing spaces.
+    line = hex_Dump_Reserve_Line(writer);
+    iter = line;
+    *iter++ = '\n';
+    memset(iter, ' ', offsetDigitCount + 7);
+    iter += offsetDigitCount + 7;
+    for (size_t byteIter = 0; byteIter <= highest_Set_Bit_32(differentMask); ++byteIter, iter += 3)
+    {
+        bool different = (differentMask >> byteIter) & 1;
+        iter[0] = different ? '^' : ' ';
+        iter[1] = different ? '^' : ' ';
+        iter[2] = ' ';
+    }
+    //remove the space after the last marker
+    --iter;
+    writer->blockLength += (size_t)(iter - line);
+}
+
+static void hex_Dump_Write_Diff(hexDumpWriter *writer, const uint8_t *bufferA, const uint8_t *bufferB, uint64_t bufferLen, ptrDataBufferDiffSummary summary)
+{
+    uint8_t offsetWidth = hex_Dump_Offset_Width(bufferLen);
+    dataBufferDiffSummary localSummary;
+    memset(&localSummary, 0, sizeof(dataBufferDiffSummary));
+    hex_Dump_Write_Header(writer, (uint8_t)(offsetWidth + 2), bufferLen);//+2 for the "A "
+    for (uint64_t offset = 0; offset < bufferLen; offset += 16)
+    {
+        size_t count = (size_t)M_Min(bufferLen - offset, 16);
+        uint16_t differentMask = 0;
+        if (count == 16)
+        {
+            differentMask = compare_16_Bytes(&bufferA[offset], &bufferB[offset]);
+        }
+        else
+        {
+            for (size_t byteIter = 0; byteIter < count; ++byteIter)
+            {
+                if (bufferA[offset + byteIter] != bufferB[offset + byteIter])
+                {
+                    differentMask |= (uint16_t)(1 << byteIter);
+                }
+            }
+        }
+        if (differentMask)
+        {
+            if (localSummary.mismatchCount == 0)
+            {
+                localSummary.firstMismatchOffset = offset + lowest_Set_Bit_32(differentMask);
+            }
+            localSummary.lastMismatchOffset = offset + highest_Set_Bit_32(differentMask);
+            localSummary.mismatchCount += count_Set_Bits_16(differentMask);
+            ++localSummary.mismatchLineCount;
+            hex_Dump_Write_Diff_Line(writer, offset, offsetWidth, &bufferA[offset], &bufferB[offset], count, differentMask);
+        }
+    }
+    if (localSummary.mismatchCount > 0)
+    {
+        //with four full width 64bit values this is longer than HEX_DUMP_MAX_LINE_LENGTH, so it is formatted on its own and appended
+        char summaryText[HEX_DUMP_MAX_LINE_LENGTH * 2];
+        int summaryLength = snprintf(summaryText, sizeof(summaryText), "\n  %"PRIu64" bytes differ in %"PRIu64" lines. First difference at 0x%"PRIX64", last at 0x%"PRIX64"\n\n", localSummary.mismatchCount, localSummary.mismatchLineCount, localSummary.firstMismatchOffset, localSummary.lastMismatchOffset);
+        if (summaryLength > 0)
+        {
+            hex_Dump_Append(writer, summaryText, M_Min((size_t)summaryLength, sizeof(summaryText) - 1));
+        }
+    }
+    else
+    {
+        hex_Dump_Append(writer, "\n  No differences\n\n", 19);
+    }
+    hex_Dump_Writer_Finish(writer);
+    if (summary)
+    {
+        memcpy(summary, &localSummary, sizeof(dataBufferDiffSummary));
+    }
+}
+
+void print_Data_Buffer_Diff(const uint8_t *bufferA, const uint8_t *bufferB, uint64_t bufferLen, ptrDataBufferDiffSummary summary)
+{
+    print_Data_Buffer_Diff_To_File(stdout, bufferA, bufferB, bufferLen, summary);
+}
+
+int print_Data_Buffer_Diff_To_File(FILE *outputFile, const uint8_t *bufferA, const uint8_t *bufferB, uint64_t bufferLen, ptrDataBufferDiffSummary summary)
+{
+    hexDumpWriter writer;
+    if (!outputFile || ((!bufferA || !bufferB) && bufferLen > 0))
+    {
+        return BAD_PARAMETER;
+    }
+    hex_Dump_Writer_Init(&writer, HEX_DUMP_OUTPUT_FILE);
+    writer.outputFile = outputFile;
+    hex_Dump_Write_Diff(&writer, bufferA, bufferB, bufferLen, summary);
+    return writer.outputError ? FAILURE : SUCCESS;
+}
+
+int print_Data_Buffer_Diff_To_FD(int fileDescriptor, const uint8_t *bufferA, const uint8_t *bufferB, uint64_t bufferLen, ptrDataBufferDiffSummary summary)
+{
+    hexDumpWriter writer;
+    if (fileDescriptor < 0 || ((!bufferA || !bufferB) && bufferLen > 0))
+    {
+        return BAD_PARAMETER;
+    }
+    hex_Dump_Writer_Init(&writer, HEX_DUMP_OUTPUT_FD);
+    writer.outputFD = fileDescriptor;
+    hex_Dump_Write_Diff(&writer, bufferA, bufferB, bufferLen, summary);
+    return writer.outputError ? FAILURE : SUCCESS;
+}
+
+uint64_t format_Data_Buffer_Diff(char *outputBuffer, size_t outputBufferSize, const uint8_t *bufferA, const uint8_t *bufferB, uint64_t bufferLen, ptrDataBufferDiffSummary summary)
+{
+    hexDumpWriter writer;
+    if ((!outputBuffer && outputBufferSize > 0) || ((!bufferA || !bufferB) && bufferLen > 0))
+    {
+        return 0;
+    }
+    hex_Dump_Writer_Init(&writer, HEX_DUMP_OUTPUT_BUFFER);
+    writer.outputBuffer = outputBuffer;
+    writer.outputBufferSize = outputBuffer ? outputBufferSize : 0;
+    hex_Dump_Write_Diff(&writer, bufferA, bufferB, bufferLen, summary);
+    return writer.outputLength;
+}
+
+M_STATIC_INLINE int8_t hex_Char_To_Nibble(char character)
+{
+    if (character >= '0' && character <= '9')
+    {
+        return (int8_t)(character - '0');
+    }
+    character |= 0x20;
+    if (character >= 'a' && character <= 'f')
+    {
+        return (int8_t)(character - 'a' + 10);
+    }
+    return -1;
+}
+
+//converts 16 characters to their hex digit values. Returns a mask with a bit set for each character that was a valid hex digit. Values for invalid characters are undefined.
+static uint16_t hex_Chars_To_Nibbles_16(const char *characters, uint8_t nibbles[16])
+{
+#if defined (OPENSEA_SIMD_SSE2)
+    __m128i chars = _mm_loadu_si128((const __m128i*)characters);
+    __m128i lowerChars = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+    //shift '0' - '9' and 'a' - 'f' to the bottom of the signed range so one signed compare checks each range
+    __m128i isDigit = _mm_cmplt_epi8(_mm_add_epi8(chars, _mm_set1_epi8((char)(-128 - '0'))), _mm_set1_epi8(-128 + 10));
+    __m128i isLetter = _mm_cmplt_epi8(_mm_add_epi8(lowerChars, _mm_set1_epi8((char)(-128 - 'a'))), _mm_set1_epi8(-128 + 6));
+    __m128i values = _mm_or_si128(_mm_and_si128(isDigit, _mm_sub_epi8(chars, _mm_set1_epi8('0'))), _mm_and_si128(isLetter, _mm_sub_epi8(lowerChars, _mm_set1_epi8('a' - 10))));
+    _mm_storeu_si128((__m128i*)nibbles, values);
+    return (uint16_t)_mm_movemask_epi8(_mm_or_si128(isDigit, isLetter));
+#elif defined (OPENSEA_SIMD_NEON)
+    uint8x16_t chars = vld1q_u8((const uint8_t*)characters);
+    uint8x16_t lowerChars = vorrq_u8(chars, vdupq_n_u8(0x20));
+    uint8x16_t digitValues = vsubq_u8(chars, vdupq_n_u8('0'));
+    uint8x16_t letterValues = vsubq_u8(lowerChars, vdupq_n_u8('a'));
+    uint8x16_t isDigit = vcltq_u8(digitValues, vdupq_n_u8(10));
+    uint8x16_t isLetter = vcltq_u8(letterValues, vdupq_n_u8(6));
+    vst1q_u8(nibbles, vbslq_u8(isDigit, digitValues, vaddq_u8(letterValues, vdupq_n_u8(10))));
+    return movemask_NEON(vorrq_u8(isDigit, isLetter));
+#else
+    uint16_t validMask = 0;
+    for (uint8_t charIter = 0; charIter < 16; ++charIter)
+    {
+        int8_t nibble = hex_Char_To_Nibble(characters[charIter]);
+        if (nibble >= 0)
+        {
+            validMask |= (uint16_t)(1 << charIter);
+        }
+        nibbles[charIter] = (uint8_t)nibble;
+    }
+    return validMask;
+#endif
+}
+
+//Parses a full 16 byte "XX XX ... XX " line (48 characters) from a dump. Returns false if the characters are not exactly in that format.
+static bool parse_Hex_Dump_Bytes_16(const char *line, uint8_t *data)
+{
+    //hex digits are expected at positions 0 and 1 of every 3 characters, a space at position 2
+    static const uint16_t digitPositions[3] = { 0xB6DB, 0xDB6D, 0x6DB6 };
+    uint8_t nibbles[48];
+    for (uint8_t blockIter = 0; blockIter < 3; ++blockIter)
+    {
+        if (hex_Chars_To_Nibbles_16(&line[blockIter * 16], &nibbles[blockIter * 16]) != digitPositions[blockIter])
+        {
+            return false;
+        }
+    }
+    for (uint8_t byteIter = 0; byteIter < 16; ++byteIter)
+    {
+        if (line[byteIter * 3 + 2] != ' ')
+        {
+            return false;
+        }
+        data[byteIter] = (uint8_t)((nibbles[byteIter * 3] << 4) | nibbles[byteIter * 3 + 1]);
+    }
+    return true;
+}
+
+int parse_Hex_String(const char *hexString, size_t stringLength, uint8_t *dataBuffer, size_t dataBufferSize, size_t *bytesParsed)
+{
+    const char *iter = hexString;
+    const char *end = hexString + stringLength;
+    size_t dataLength = 0;
+    int ret = SUCCESS;
+    if ((!hexString && stringLength > 0) || (!dataBuffer && dataBufferSize > 0))
+    {
+        return BAD_PARAMETER;
+    }
+    if (stringLength >= 2 && iter[0] == '0' && (iter[1] == 'x' || iter[1] == 'X'))
+    {
+        iter += 2;
+    }
+    while (iter < end)
+    {
+        uint8_t nibbles[32];
+        int8_t highNibble = 0, lowNibble = 0;
+        if (*iter == ' ' || *iter == '\t' || *iter == '\r' || *iter == '\n')
+        {
+            ++iter;
+            continue;
+        }
+        //convert 16 bytes at a time while the string has runs of 32 hex digits
+        if (end - iter >= 32 && dataBufferSize - dataLength >= 16 && hex_Chars_To_Nibbles_16(iter, &nibbles[0]) == UINT16_MAX && hex_Chars_To_Nibbles_16(iter + 16, &nibbles[16]) == UINT16_MAX)
+        {
+            for (uint8_t byteIter = 0; byteIter < 16; ++byteIter)
+            {
+                dataBuffer[dataLength + byteIter] = (uint8_t)((nibbles[byteIter * 2] << 4) | nibbles[byteIter * 2 + 1]);
+            }
+            dataLength += 16;
+            iter += 32;
+            continue;
+        }
+        highNibble = hex_Char_To_Nibble(iter[0]);
+        lowNibble = (end - iter >= 2) ? hex_Char_To_Nibble(iter[1]) : -1;
+        if (highNibble < 0 || lowNibble < 0)
+        {
+            ret = FAILURE;
+            break;
+        }
+        if (dataLength == dataBufferSize)
+        {
+            ret = FAILURE;
+            break;
+        }
+        dataBuffer[dataLength++] = (uint8_t)((highNibble << 4) | lowNibble);
+        iter += 2;
+    }
+    if (bytesParsed)
+    {
+        *bytesParsed = dataLength;
+    }
+    return ret;
+}
+
+//parses one "0x<offset> XX XX ..." line of a dump (leading spaces already removed). Returns the number of bytes parsed or -1 for a bad line.
+static int parse_Hex_Dump_Line(const char *line, const char *lineEnd, uint64_t *offset, uint8_t lineData[16])
+{
+    const char *iter = line + 2;//skip 0x
+    int byteCount = 0;
+    *offset = 0;
+    for (; iter < lineEnd && *iter != ' '; ++iter)
+    {
+        int8_t nibble = hex_Char_To_Nibble(*iter);
+        if (nibble < 0 || (*offset >> 60) > 0)
+        {
+            return -1;
+        }
+        *offset = (*offset << 4) | (uint8_t)nibble;
+    }
+    if (iter == line + 2 || iter == lineEnd)
+    {
+        return -1;
+    }
+    ++iter;//space after the offset
+    if (lineEnd - iter >= 48 && parse_Hex_Dump_Bytes_16(iter, lineData))
+    {
+        return 16;
+    }
+    //partial line: each byte is "XX ". Two spaces in a row start the padding/ASCII column.
+    while (byteCount < 16 && iter < lineEnd && *iter != ' ')
+    {
+        int8_t highNibble = hex_Char_To_Nibble(iter[0]);
+        int8_t lowNibble = (lineEnd - iter >= 2) ? hex_Char_To_Nibble(iter[1]) : -1;
+        if (highNibble < 0 || lowNibble < 0 || (lineEnd - iter > 2 && iter[2] != ' '))
+        {
+            return -1;
+        }
+        lineData[byteCount++] = (uint8_t)((highNibble << 4) | lowNibble);
+        iter += 3;
+    }
+    return byteCount;
+}
+
+int parse_Data_Buffer_Dump(const char *dumpText, size_t textLength, uint8_t *dataBuffer, size_t dataBufferSize, size_t *bytesParsed)
+{
+    const char *lineStart = dumpText;
+    const char *textEnd = dumpText + textLength;
+    size_t dataLength = 0;
+    uint64_t baseOffset = 0;
+    bool firstLine = true, collapsed = false, previousLineValid = false;
+    uint8_t previousLine[16] = { 0 };
+    int ret = SUCCESS;
+    if ((!dumpText && textLength > 0) || (!dataBuffer && dataBufferSize > 0))
+    {
+        return BAD_PARAMETER;
+    }
+    while (lineStart < textEnd && ret == SUCCESS)
+    {
+        const char *lineEnd = (const char*)memchr(lineStart, '\n', (size_t)(textEnd - lineStart));
+        const char *nextLine = NULL;
+        if (!lineEnd)
+        {
+            lineEnd = textEnd;
+        }
+        nextLine = lineEnd + 1;
+        if (lineEnd > lineStart && lineEnd[-1] == '\r')
+        {
+            --lineEnd;
+        }
+        while (lineStart < lineEnd && (*lineStart == ' ' || *lineStart == '\t'))
+        {
+            ++lineStart;
+        }
+        if (lineEnd - lineStart >= 2 && lineStart[0] == '0' && (lineStart[1] == 'x' || lineStart[1] == 'X'))
+        {
+            uint64_t offset = 0;
+            uint8_t lineData[16];
+            int byteCount = parse_Hex_Dump_Line(lineStart, lineEnd, &offset, lineData);
+            if (byteCount < 0)
+            {
+                ret = FAILURE;
+                break;
+            }
+            if (firstLine)
+            {
+                baseOffset = offset;
+                firstLine = false;
+            }
+            if (offset < baseOffset || offset - baseOffset < dataLength)
+            {
+                ret = FAILURE;
+                break;
+            }
+            //fill in lines that were collapsed to "*" with copies of the line before them
+            if (collapsed)
+            {
+                if (!previousLineValid || (offset - baseOffset - dataLength) % 16 != 0)
+                {
+                    ret = FAILURE;
+                    break;
+                }
+                while (dataLength < offset - baseOffset)
+                {
+                    if (dataBufferSize - dataLength < 16)
+                    {
+                        ret = FAILURE;
+                        break;
+                    }
+                    memcpy(&dataBuffer[dataLength], previousLine, 16);
+                    dataLength += 16;
+                }
+                collapsed = false;
+            }
+            else if (offset - baseOffset != dataLength)
+            {
+                ret = FAILURE;
+            }
+            if (ret != SUCCESS)
+            {
+                break;
+            }
+            if (dataBufferSize - dataLength < (size_t)byteCount)
+            {
+                ret = FAILURE;
+                break;
+            }
+            memcpy(&dataBuffer[dataLength], lineData, (size_t)byteCount);
+            dataLength += (size_t)byteCount;
+            previousLineValid = byteCount == 16;
+            if (previousLineValid)
+            {
+                memcpy(previousLine, lineData, 16);
+            }
+        }
+        else if (lineEnd - lineStart == 1 && *lineStart == '*')
+        {
+            collapsed = true;
+        }
+        else
+        {
+            //Anything else must be the column header (hex digits and spaces) or a blank line
+            for (const char *iter = lineStart; iter < lineEnd; ++iter)
+            {
+                if (*iter != ' ' && hex_Char_To_Nibble(*iter) < 0)
+                {
+                    ret = FAILURE;
+                    break;
+                }
+            }
+        }
+        lineStart = nextLine;
+    }
+    if (ret == SUCCESS && collapsed)
+    {
+        //a dump that ends in "*" is missing its last line, so the length of the data is unknown
+        ret = FAILURE;
+    }
+    if (bytesParsed)
+    {
+        *bytesParsed = dataLength;
+    }
+    return ret;
+}
+
+static const char *metricUnitStrings[] = { "B", "KB", "MB", "GB", "TB", "PB", "EB", "ZB", "YB" };
+static const char *capacityUnitStrings[] = { "B", "KiB", "MiB", "GiB", "TiB", "PiB", "EiB", "ZiB", "YiB" };
+#define CAPACITY_UNIT_COUNT 9
+M_STATIC_ASSERT(sizeof(metricUnitStrings) / sizeof(metricUnitStrings[0]) == CAPACITY_UNIT_COUNT, metricUnitStrings_matches_unit_count);
+M_STATIC_ASSERT(sizeof(capacityUnitStrings) / sizeof(capacityUnitStrings[0]) == CAPACITY_UNIT_COUNT, capacityUnitStrings_matches_unit_count);
+
+int metric_Unit_Convert(double *byteValue, char** metricUnit)
+{
+    uint8_t unitCounter = 0;
+
+    while ((*byteValue / 1000.0) >= 1 && (unitCounter + 1) < CAPACITY_UNIT_COUNT)
+    {
+        *byteValue = *byteValue / 1000.00;
+        unitCounter += 1;
+    }
+    strcpy(*metricUnit, metricUnitStrings[unitCounter]);
+    return SUCCESS;
+}
+
+int capacity_Unit_Convert(double *byteValue, char** capacityUnit)
+{
+    uint8_t unitCounter = 0;
+
+    while ((*byteValue / 1024.0) >= 1 && (unitCounter + 1) < CAPACITY_UNIT_COUNT)
+    {
+        *byteValue = *byteValue / 1024.00;
+        unitCounter += 1;
+    }
+    strcpy(*capacityUnit, capacityUnitStrings[unitCounter]);
+    return SUCCESS;
+}
+
+//powers of 1000 that fit in 64 bits, B through EB
+static const uint64_t metricUnitDivisors[7] = { UINT64_C(1), UINT64_C(1000), UINT64_C(1000000), UINT64_C(1000000000), UINT64_C(1000000000000), UINT64_C(1000000000000000), UINT64_C(1000000000000000000) };
+
+#define CAPACITY_MAX_DECIMAL_PLACES 9
+
+//Writes "<integer>.<fraction> <unit>". The fraction is worked out one digit at a time from the integer remainder (long division) so no floating point is used.
+//Rounds half up, moving to the next unit if rounding makes the value reach the unit size (ex: 1023.999 KiB -> 1.00 MiB).
+static size_t format_Capacity(uint64_t byteValue, bool metric, uint8_t decimalPlaces, char *buffer, size_t bufferSize)
+{
+    uint8_t unit = 0;
+    uint64_t divisor = 1, integerPart = 0, remainder = 0;
+    char fraction[CAPACITY_MAX_DECIMAL_PLACES] = { 0 };
+    char digits[UINT64_DECIMAL_STRING_LENGTH] = { 0 };
+    size_t digitCount = 0, length = 0;
+    const char *unitString = NULL;
+    size_t unitLength = 0;
+    if (!buffer)
+    {
+        return 0;
+    }
+    decimalPlaces = M_Min(decimalPlaces, CAPACITY_MAX_DECIMAL_PLACES);
+    if (metric)
+    {
+        //count how many unit sizes the value is at or above instead of dividing in a loop
+        for (uint8_t unitIter = 1; unitIter < 7; ++unitIter)
+        {
+            unit += (uint8_t)(byteValue >= metricUnitDivisors[unitIter]);
+        }
+        divisor = metricUnitDivisors[unit];
+        integerPart = byteValue / divisor;
+        remainder = byteValue % divisor;
+    }
+    else
+    {
+        //each binary unit is 10 more bits, so the unit comes from the position of the highest set bit
+        unit = (uint8_t)(highest_Set_Bit_64(byteValue | 1) / 10);
+        integerPart = byteValue >> (unit * 10);
+        remainder = byteValue & ((UINT64_C(1) << (unit * 10)) - 1);
+        divisor = UINT64_C(1) << (unit * 10);
+    }
+    //remainder is always less than 2^60 (or 10^18), so multiplying by 10 cannot overflow
+    for (uint8_t digitIter = 0; digitIter < decimalPlaces; ++digitIter)
+    {
+        remainder *= 10;
+        fraction[digitIter] = (char)('0' + remainder / divisor);
+        remainder %= divisor;
+    }
+    if (remainder >= divisor - remainder)
+    {
+        int8_t digitIter = (int8_t)(decimalPlaces - 1);
+        for (; digitIter >= 0 && fraction[digitIter] == '9'; --digitIter)
+        {
+            fraction[digitIter] = '0';
+        }
+        if (digitIter >= 0)
+        {
+            ++fraction[digitIter];
+        }
+        else
+        {
+            ++integerPart;
+            if (integerPart == (metric ? UINT64_C(1000) : UINT64_C(1024)) && unit + 1 < (metric ? 7 : CAPACITY_UNIT_COUNT))
+            {
+                ++unit;
+                integerPart = 1;
+            }
+        }
+    }
+    unitString = metric ? metricUnitStrings[unit] : capacityUnitStrings[unit];
+    unitLength = strlen(unitString);
+    digitCount = uint64_To_Decimal_Digits(integerPart, &digits[UINT64_DECIMAL_STRING_LENGTH - 1], 0);
+    length = digitCount + (decimalPlaces > 0 ? 1 + decimalPlaces : 0) + 1 + unitLength;
+    if (length + 1 > bufferSize)
+    {
+        return 0;
+    }
+    memcpy(buffer, &digits[UINT64_DECIMAL_STRING_LENGTH - 1 - digitCount], digitCount);
+    buffer += digitCount;
+    if (decimalPlaces > 0)
+    {
+        *buffer++ = '.';
+        memcpy(buffer, fraction, decimalPlaces);
+        buffer += decimalPlaces;
+    }
+    *buffer++ = ' ';
+    memcpy(buffer, unitString, unitLength + 1);
+    return length;
+}
+
+size_t format_Capacity_Metric(uint64_t byteValue, uint8_t decimalPlaces, char *buffer, size_t bufferSize)
+{
+    return format_Capacity(byteValue, true, decimalPlaces, buffer, bufferSize);
+}
+
+size_t format_Capacity_Binary(uint64_t byteValue, uint8_t decimalPlaces, char *buffer, size_t bufferSize)
+{
+    return format_Capacity(byteValue, false, decimalPlaces, buffer, bufferSize);
+}
+
+size_t format_Capacity_Array(const uint64_t *byteValues, size_t count, bool metric, uint8_t decimalPlaces, char *outputStrings, size_t stringSize)
+{
+    size_t successCount = 0;
+    if (!byteValues || !outputStrings || stringSize == 0)
+    {
+        return 0;
+    }
+    for (size_t iter = 0; iter < count; ++iter)
+    {
+        char *outputString = &outputStrings[iter * stringSize];
+        if (format_Capacity(byteValues[iter], metric, decimalPlaces, outputString, stringSize) > 0)
+        {
+            ++successCount;
+        }
+        else
+        {
+            outputString[0] = '\0';
+        }
+    }
+    return successCount;
+}
+
+void convert_Seconds_To_Displayable_Time_64(uint64_t secondsToConvert, uint64_t *years, uint16_t *days, uint8_t *hours, uint8_t *minutes, uint8_t *seconds)
+{
+    uint64_t tempCalcValue = secondsToConvert;
+    //get seconds up to a maximum of 60
+    if (seconds)
+    {
+        *seconds = (uint8_t)(tempCalcValue % 60);
+    }
+    tempCalcValue /= 60;
+    //get minutes up to a maximum of 60
+    if (minutes)
+    {
+        *minutes = (uint8_t)(tempCalcValue % 60);
+    }
+    tempCalcValue /= 60;
+    //get hours up to a maximum of 24
+    if (hours)
+    {
+        *hours = (uint8_t)(tempCalcValue % 24);
+    }
+    tempCalcValue /= 24;
+    //get days up to 365
+    if (days)
+    {
+        *days = (uint16_t)(tempCalcValue % 365);
+    }
+    tempCalcValue /= 365;
+    //get years
+    if (years)
+    {
+        *years = tempCalcValue;
+    }
+}
+
+void convert_Seconds_To_Displayable_Time(uint64_t secondsToConvert, uint8_t *years, uint8_t *days, uint8_t *hours, uint8_t *minutes, uint8_t *seconds)
+{
+    uint64_t fullYears = 0;
+    uint16_t fullDays = 0;
+    convert_Seconds_To_Displayable_Time_64(secondsToConvert, &fullYears, &fullDays, hours, minutes, seconds);
+    //saturate rather than wrapping around to a small, believable, but wrong number
+    if (years)
+    {
+        *years = (uint8_t)M_Min(fullYears, UINT8_MAX);
+    }
+    if (days)
+    {
+        *days = (uint8_t)M_Min(fullDays, UINT8_MAX);
+    }
+}
+
+//Writes " 1 year 2 days 3 hours 4 minutes 5 seconds " to output in the same format print_Time_To_Screen has always used. Units in the present mask with a value of zero are skipped.
+//Units not in the present mask are skipped too. The trailing space is only added if at least one unit is present. Returns the length, not counting the null terminator.
+static size_t write_Duration_String(const uint64_t unitValues[5], uint8_t presentMask, char output[DURATION_STRING_LENGTH])
+{
+    static const char *unitNames[5] = { "year", "day", "hour", "minute", "second" };
+    static const size_t unitNameLengths[5] = { 4, 3, 4, 6, 6 };
+    size_t length = 0;
+    for (uint8_t unit = 0; unit < 5; ++unit)
+    {
+        if ((presentMask & (1 << unit)) && unitValues[unit] > 0)
+        {
+            char digits[UINT64_DECIMAL_STRING_LENGTH];
+            size_t digitCount = uint64_To_Decimal_Digits(unitValues[unit], &digits[UINT64_DECIMAL_STRING_LENGTH - 1], 0);
+            output[length++] = ' ';
+            memcpy(&output[length], &digits[UINT64_DECIMAL_STRING_LENGTH - 1 - digitCount], digitCount);
+            length += digitCount;
+            output[length++] = ' ';
+            memcpy(&output[length], unitNames[unit], unitNameLengths[unit]);
+            length += unitNameLengths[unit];
+            if (unitValues[unit] > 1)
+            {
+                output[length++] = 's';
+            }
+        }
+    }
+    if (presentMask)
+    {
+        output[length++] = ' ';
+    }
+    output[length] = '\0';
+    return length;
+}
+
+void print_Time_To_Screen(uint8_t *years, uint8_t *days, uint8_t *hours, uint8_t *minutes, uint8_t *seconds)
+{
+    char timeString[DURATION_STRING_LENGTH] = { 0 };
+    uint64_t unitValues[5] = { years ? *years : 0, days ? *days : 0, hours ? *hours : 0, minutes ? *minutes : 0, seconds ? *seconds : 0 };
+    uint8_t presentMask = (uint8_t)((years ? BIT0 : 0) | (days ? BIT1 : 0) | (hours ? BIT2 : 0) | (minutes ? BIT3 : 0) | (seconds ? BIT4 : 0));
+    if (write_Duration_String(unitValues, presentMask, timeString) > 0)
+    {
+        printf("%s", timeString);
+    }
+}
+
+size_t format_Duration(uint64_t secondsToFormat, char *buffer, size_t bufferSize)
+{
+    char durationString[DURATION_STRING_LENGTH] = { 0 };
+    uint64_t unitValues[5] = { 0 };
+    uint16_t days = 0;
+    uint8_t hours = 0, minutes = 0, seconds = 0;
+    size_t length = 0;
+    convert_Seconds_To_Displayable_Time_64(secondsToFormat, &unitValues[0], &days, &hours, &minutes, &seconds);
+    unitValues[1] = days;
+    unitValues[2] = hours;
+    unitValues[3] = minutes;
+    unitValues[4] = seconds;
+    length = write_Duration_String(unitValues, 0x1F, durationString);
+    if (!buffer || length + 1 > bufferSize)
+    {
+        return 0;
+    }
+    memcpy(buffer, durationString, length + 1);
+    return length;
+}
+
+size_t format_Duration_Array(const uint64_t *secondsToFormat, size_t count, char *outputStrings, size_t stringSize)
+{
+    size_t successCount = 0;
+    if (!secondsToFormat || !outputStrings || stringSize == 0)
+    {
+        return 0;
+    }
+    for (size_t iter = 0; iter < count; ++iter)
+    {
+        char *outputString = &outputStrings[iter * stringSize];
+        if (format_Duration(secondsToFormat[iter], outputString, stringSize) > 0)
+        {
+            ++successCount;
+        }
+        else
+        {
+            outputString[0] = '\0';
+        }
+    }
+    return successCount;
+}
+
+//Each thread gets its own default generator state so that threads using the non _r functions do not race each other.
+M_THREAD_LOCAL uint32_t seed32Array[2] = { 0x05EAF00D, 0x05EA51DE };
+M_THREAD_LOCAL uint64_t seed64Array[2] = { 0x05EAF00D, 0x05EA51DE };
+
+//The generator steps are written once against a plain seed array so that the _r versions (explicit state) and the original versions (thread local seed32Array/seed64Array) produce identical sequences.
+//shift values chosen randomly
+M_STATIC_INLINE uint32_t xorshiftplus32_Step(uint32_t seed[2])
+{
+    uint32_t x = seed[0];
+    uint32_t const y = seed[1];
+    seed[0] = y;
+    x ^= x << 13;//a
+    seed[1] = x ^ y ^ (x >> 17) ^ (y >> 7); //b, c
+    return (seed[1] + y);
+}
+
+//shift values chosen randomly
+M_STATIC_INLINE uint64_t xorshiftplus64_Step(uint64_t seed[2])
+{
+    uint64_t x = seed[0];
+    uint64_t const y = seed[1];
+    seed[0] = y;
+    x ^= x << 27;//a
+    seed[1] = x ^ y ^ (x >> 13) ^ (y >> 32); //b, c
+    return (seed[1] + y);
+}
+
+static void seed_32_Array(uint32_t seedArray[2], uint32_t seed)
+{
+    //first initialize
+    seedArray[0] = seed;
+    seedArray[1] = (uint32_t)((int32_t)seed >> 1);//converting to signed int to perform arithmetic shift, then back for the seed value
+    //using that initialization, run the random number generator for a more random seed...may or may not be needed, but I'm doing this anyways - Tyler
+    seedArray[0] = xorshiftplus32_Step(seedArray);
+    seedArray[0] = xorshiftplus32_Step(seedArray);
+}
+
+static void seed_64_Array(uint64_t seedArray[2], uint64_t seed)
+{
+    //first initialize
+    seedArray[0] = seed;
+    seedArray[1] = (uint64_t)((int64_t)seed >> 2);//converting to signed int to perform arithmetic shift, then back for the seed value
+    //using that initialization, run the random number generator for a more random seed...may or may not be needed, but I'm doing this anyways - Tyler
+    seedArray[0] = xorshiftplus64_Step(seedArray);
+    seedArray[0] = xorshiftplus64_Step(seedArray);
+}
+
+void seed_32(uint32_t seed)
+{
+    seed_32_Array(seed32Array, seed);
+}
+
+void seed_64(uint64_t seed)
+{
+    seed_64_Array(seed64Array, seed);
+}
+
+void seed_32_r(xorshiftplus32State *state, uint32_t seed)
+{
+    if (state)
+    {
+        seed_32_Array(state->seed, seed);
+    }
+}
+
+void seed_64_r(xorshiftplus64State *state, uint64_t seed)
+{
+    if (state)
+    {
+        seed_64_Array(state->seed, seed);
+    }
+}
+
+uint32_t xorshiftplus32(void)
+{
+    return xorshiftplus32_Step(seed32Array);
+}
+
+uint64_t xorshiftplus64(void)
+{
+    return xorshiftplus64_Step(seed64Array);
+}
+
+uint32_t xorshiftplus32_r(xorshiftplus32State *state)
+{
+    return xorshiftplus32_Step(state->seed);
+}
+
+uint64_t xorshiftplus64_r(xorshiftplus64State *state)
+{
+    return xorshiftplus64_Step(state->seed);
+}
+
+//maps a random number into the range [rangeMin, rangeMax]
+M_STATIC_INLINE uint32_t scale_To_Range_32(uint32_t randomValue, uint32_t rangeMin, uint32_t rangeMax)
+{
+    //doing this to prevent a possible overflow
+    if (rangeMax == UINT32_MAX)
+    {
+        rangeMax -= 1;
+    }
+    //this will slightly bias the randomness...but not enough for us to care at this point in time
+    //return (randomValue % (rangeMax + 1 - rangeMin) + rangeMin);
+
+    //This method below should return unbiased results. see http://c-faq.com/lib/randrange.html
+    return (rangeMin + randomValue / (UINT32_MAX / (rangeMax - rangeMin + 1) + 1));
+}
+
+M_STATIC_INLINE uint64_t scale_To_Range_64(uint64_t randomValue, uint64_t rangeMin, uint64_t rangeMax)
+{
+    //doing this to prevent a possible overflow
+    if (rangeMax == UINT64_MAX)
+    {
+        rangeMax -= 1;
+    }
+    //this will slightly bias the randomness...but not enough for us to care at this point in time
+    //return (randomValue % (rangeMax + 1 - rangeMin) + rangeMin);
+
+    //This method below should return unbiased results. see http://c-faq.com/lib/randrange.html
+    return (rangeMin + randomValue / (UINT64_MAX / (rangeMax - rangeMin + 1) + 1));
+}
+
+uint32_t random_Range_32(uint32_t rangeMin, uint32_t rangeMax)
+{
+    return scale_To_Range_32(xorshiftplus32(), rangeMin, rangeMax);
+}
+
+uint64_t random_Range_64(uint64_t rangeMin, uint64_t rangeMax)
+{
+    return scale_To_Range_64(xorshiftplus64(), rangeMin, rangeMax);
+}
+
+uint32_t random_Range_32_r(xorshiftplus32State *state, uint32_t rangeMin, uint32_t rangeMax)
+{
+    return scale_To_Range_32(xorshiftplus32_r(state), rangeMin, rangeMax);
+}
+
+uint64_t random_Range_64_r(xorshiftplus64State *state, uint64_t rangeMin, uint64_t rangeMax)
+{
+    return scale_To_Range_64(xorshiftplus64_r(state), rangeMin, rangeMax);
+}
+
+//SplitMix64 finalizer. Turns any 64bit value (including small, sequential ones) into a well mixed one. Used to expand a single seed into full generator states.
+M_STATIC_INLINE uint64_t splitmix64_Mix(uint64_t value)
+{
+    value = (value ^ (value >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+    value = (value ^ (value >> 27)) * UINT64_C(0x94D049BB133111EB);
+    return value ^ (value >> 31);
+}
+
+#define SPLITMIX64_INCREMENT UINT64_C(0x9E3779B97F4A7C15)
+
+void seed_Xoshiro128x4(xoshiro128x4State *state, uint64_t seed)
+{
+    if (!state)
+    {
+        return;
+    }
+    for (uint8_t lane = 0; lane < XOSHIRO128X4_LANES; ++lane)
+    {
+        uint64_t low = splitmix64_Mix(seed + SPLITMIX64_INCREMENT * (UINT64_C(2) * lane + 1));
+        uint64_t high = splitmix64_Mix(seed + SPLITMIX64_INCREMENT * (UINT64_C(2) * lane + 2));
+        state->s[0][lane] = M_DoubleWord0(low);
+        state->s[1][lane] = M_DoubleWord1(low);
+        state->s[2][lane] = M_DoubleWord0(high);
+        state->s[3][lane] = M_DoubleWord1(high);
+        if ((low | high) == 0)
+        {
+            //all zero is the one state xoshiro can never leave
+            state->s[0][lane] = 1;
+        }
+    }
+}
+
+//Runs all lanes of the generator blockCount times, writing XOSHIRO128X4_BLOCK_SIZE bytes per step: lane 0's 32bit result first, then lane 1, etc, each little endian.
+//The scalar version produces exactly the same bytes as the SIMD versions so output does not depend on the CPU it was made on.
+static void xoshiro128x4_Generate_Blocks(xoshiro128x4State *state, uint8_t *output, uint64_t blockCount)
+{
+#if defined (OPENSEA_SIMD_SSE2)
+    __m128i s0 = _mm_loadu_si128((const __m128i*)state->s[0]);
+    __m128i s1 = _mm_loadu_si128((const __m128i*)state->s[1]);
+    __m128i s2 = _mm_loadu_si128((const __m128i*)state->s[2]);
+    __m128i s3 = _mm_loadu_si128((const __m128i*)state->s[3]);
+    for (uint64_t block = 0; block < blockCount; ++block)
+    {
+        __m128i sum = _mm_add_epi32(s0, s3);
+        __m128i result = _mm_add_epi32(_mm_or_si128(_mm_slli_epi32(sum, 7), _mm_srli_epi32(sum, 25)), s0);
+        __m128i shifted = _mm_slli_epi32(s1, 9);
+        _mm_storeu_si128((__m128i*)&output[block * XOSHIRO128X4_BLOCK_SIZE], result);
+        s2 = _mm_xor_si128(s2, s0);
+        s3 = _mm_xor_si128(s3, s1);
+        s1 = _mm_xor_si128(s1, s2);
+        s0 = _mm_xor_si128(s0, s3);
+        s2 = _mm_xor_si128(s2, shifted);
+        s3 = _mm_or_si128(_mm_slli_epi32(s3, 11), _mm_srli_epi32(s3, 21));
+    }
+    _mm_storeu_si128((__m128i*)state->s[0], s0);
+    _mm_storeu_si128((__m128i*)state->s[1], s1);
+    _mm_storeu_si128((__m128i*)state->s[2], s2);
+    _mm_storeu_si128((__m128i*)state->s[3], s3);
+#elif defined (OPENSEA_SIMD_NEON) && !defined (OPENSEA_COMPILED_BIG_ENDIAN)
+    uint32x4_t s0 = vld1q_u32(state->s[0]);
+    uint32x4_t s1 = vld1q_u32(state->s[1]);
+    uint32x4_t s2 = vld1q_u32(state->s[2]);
+    uint32x4_t s3 = vld1q_u32(state->s[3]);
+    for (uint64_t block = 0; block < blockCount; ++block)
+    {
+        uint32x4_t sum = vaddq_u32(s0, s3);
+        uint32x4_t result = vaddq_u32(vorrq_u32(vshlq_n_u32(sum, 7), vshrq_n_u32(sum, 25)), s0);
+        uint32x4_t shifted = vshlq_n_u32(s1, 9);
+        vst1q_u8(&output[block * XOSHIRO128X4_BLOCK_SIZE], vreinterpretq_u8_u32(result));
+        s2 = veorq_u32(s2, s0);
+        s3 = veorq_u32(s3, s1);
+        s1 = veorq_u32(s1, s2);
+        s0 = veorq_u32(s0, s3);
+        s2 = veorq_u32(s2, shifted);
+        s3 = vorrq_u32(vshlq_n_u32(s3, 11), vshrq_n_u32(s3, 21));
+    }
+    vst1q_u32(state->s[0], s0);
+    vst1q_u32(state->s[1], s1);
+    vst1q_u32(state->s[2], s2);
+    vst1q_u32(state->s[3], s3);
+#else
+    for (uint64_t block = 0; block < blockCount; ++block)
+    {
+        for (uint8_t lane = 0; lane < XOSHIRO128X4_LANES; ++lane)
+        {
+            uint32_t s0 = state->s[0][lane], s1 = state->s[1][lane], s2 = state->s[2][lane], s3 = state->s[3][lane];
+            uint32_t sum = s0 + s3;
+            uint32_t shifted = s1 << 9;
+            le32_Store(&output[block * XOSHIRO128X4_BLOCK_SIZE + lane * sizeof(uint32_t)], ((sum << 7) | (sum >> 25)) + s0);
+            s2 ^= s0;
+            s3 ^= s1;
+            s1 ^= s2;
+            s0 ^= s3;
+            s2 ^= shifted;
+            s3 = (s3 << 11) | (s3 >> 21);
+            state->s[0][lane] = s0;
+            state->s[1][lane] = s1;
+            state->s[2][lane] = s2;
+            state->s[3][lane] = s3;
+        }
+    }
+#endif
+}
+
+void xoshiro128x4_Next(xoshiro128x4State *state, uint8_t output[XOSHIRO128X4_BLOCK_SIZE])
+{
+    xoshiro128x4_Generate_Blocks(state, output, 1);
+}
+
+int fill_Random_Pattern_In_Buffer_Xoshiro128x4(xoshiro128x4State *state, uint8_t *ptrData, uint64_t dataLength)
+{
+    uint64_t fullBlocks = dataLength / XOSHIRO128X4_BLOCK_SIZE;
+    uint64_t tailLength = dataLength % XOSHIRO128X4_BLOCK_SIZE;
+    if (!state || !ptrData || dataLength == 0)
+    {
+        return BAD_PARAMETER;
+    }
+    xoshiro128x4_Generate_Blocks(state, ptrData, fullBlocks);
+    if (tailLength > 0)
+    {
+        uint8_t tail[XOSHIRO128X4_BLOCK_SIZE];
+        xoshiro128x4_Generate_Blocks(state, tail, 1);
+        memcpy(&ptrData[fullBlocks * XOSHIRO128X4_BLOCK_SIZE], tail, (size_t)tailLength);
+    }
+    return SUCCESS;
+}
+
+//Generator behind fill_Random_Pattern_In_Buffer. Seeded once per thread so that buffers filled back to back (even in the same second) are different.
+static M_THREAD_LOCAL xoshiro128x4State defaultRandomPatternState;
+static M_THREAD_LOCAL bool defaultRandomPatternStateSeeded = false;
+
+int fill_Random_Pattern_In_Buffer(uint8_t *ptrData, uint32_t dataLength)
+{
+    if (dataLength == 0 || !ptrData)
+    {
+        return BAD_PARAMETER;
+    }
+    if (!defaultRandomPatternStateSeeded)
+    {
+        int64_t seconds = 0;
+        uint32_t nanoseconds = 0;
+        get_Coarse_Wall_Clock(&seconds, &nanoseconds);
+        //the address of the thread local state differs between threads started in the same instant
+        seed_Xoshiro128x4(&defaultRandomPatternState, ((uint64_t)seconds << 30) ^ nanoseconds ^ (uint64_t)(uintptr_t)&defaultRandomPatternState);
+        defaultRandomPatternStateSeeded = true;
+    }
+    return fill_Random_Pattern_In_Buffer_Xoshiro128x4(&defaultRandomPatternState, ptrData, dataLength);
+}
+
+int fill_Random_Pattern_In_Buffer_r(xorshiftplus32State *state, uint8_t *ptrData, uint32_t dataLength)
+{
+    if (!state || dataLength < sizeof(uint32_t) || !ptrData)
+    {
+        return BAD_PARAMETER;
+    }
+    for (uint32_t iter = 0; iter < (dataLength / sizeof(uint32_t)); ++iter)
+    {
+        uint32_t randomValue = xorshiftplus32_r(state);
+        memcpy(&ptrData[iter * sizeof(uint32_t)], &randomValue, sizeof(uint32_t));//memcpy since ptrData may not be 4 byte aligned
+    }
+    return SUCCESS;
+}
+
+int fill_Hex_Pattern_In_Buffer(uint32_t hexPattern, uint8_t *ptrData, uint32_t dataLength)
+{
+    uint32_t *localPtr = (uint32_t*)ptrData;
+    if (!ptrData || dataLength < sizeof(uint32_t))
+    {
+        return BAD_PARAMETER;
+    }
+    for (uint32_t iter = 0; iter < (dataLength / sizeof(uint32_t)); ++iter)
+    {
+        localPtr[iter] = hexPattern;
+    }
+    return SUCCESS;
+}
+
+int fill_Incrementing_Pattern_In_Buffer(uint8_t incrementStartValue, uint8_t *ptrData, uint32_t dataLength)
+{
+    if (!ptrData)
+    {
+        return BAD_PARAMETER;
+    }
+    for (uint32_t iter = 0; iter < dataLength; ++iter)
+    {
+        ptrData[iter] = incrementStartValue++;
+    }
+    return SUCCESS;
+}
+
+int fill_ASCII_Pattern_In_Buffer(const char *asciiPattern, uint32_t patternLength, uint8_t *ptrData, uint32_t dataLength)
+{
+    if (!ptrData || patternLength == 0 || !asciiPattern)
+    {
+        return BAD_PARAMETER;
+    }
+    for (uint32_t iter = 0; iter < dataLength; iter += patternLength)
+    {
+        memcpy(&ptrData[iter], asciiPattern, M_Min(patternLength, dataLength - iter));
+    }
+    return SUCCESS;
+}
+
+int fill_Pattern_Buffer_Into_Another_Buffer(uint8_t *inPattern, uint32_t inpatternLength, uint8_t *ptrData, uint32_t dataLength)
+{
+    if (!ptrData || inpatternLength == 0 || !inPattern || dataLength == 0)
+    {
+        return BAD_PARAMETER;
+    }
+    for (uint32_t iter = 0; iter < dataLength; iter += inpatternLength)
+    {
+        memcpy(&ptrData[iter], inPattern, M_Min(inpatternLength, dataLength - iter));
+    }
+    return SUCCESS;
+}
+
+typedef enum _eParallelFillType
+{
+    PARALLEL_FILL_RANDOM,
+    PARALLEL_FILL_REPEATING
+}eParallelFillType;
+
+//One worker's share of a parallel fill. Every worker gets a contiguous run of slices, and what goes in a slice only depends on where it is in the buffer, never on which worker fills it.
+typedef struct _parallelFillJob
 {
-    uint32_t printIter = 0, offset = 0;
-    uint32_t offsetWidth = 2;//used to figure out how wide we need to pad with 0's for consistent output, 2 is the minimum width
-    if (bufferLen <= UINT8_MAX)
+    eParallelFillType fillType;
+    uint64_t seed;//random
+    const uint8_t *pattern;//repeating
+    uint32_t patternLength;//repeating
+    uint8_t *ptrData;
+    uint64_t dataLength;
+    uint64_t firstSlice;
+    uint64_t sliceCount;
+}parallelFillJob;
+
+//Fills length bytes with pattern, starting phase bytes into it. The first copy of the pattern is written, then what has been written so far is copied after itself until the buffer is full, so most of the work is a few large memcpys.
+static void fill_Repeating_Pattern(const uint8_t *pattern, uint32_t patternLength, uint32_t phase, uint8_t *ptrData, uint64_t length)
+{
+    uint64_t filled = M_Min((uint64_t)patternLength, length);
+    uint32_t firstPart = (uint32_t)M_Min((uint64_t)(patternLength - phase), filled);
+    memcpy(ptrData, &pattern[phase], firstPart);
+    memcpy(&ptrData[firstPart], pattern, (size_t)(filled - firstPart));
+    while (filled < length)
     {
-        offsetWidth = 2;
-        printf("\n        "); //0  1  2  3  4  5  6  7  8  9  A  B  C  D  E  F  ");
+        uint64_t copyLength = M_Min(filled, length - filled);
+        memcpy(&ptrData[filled], ptrData, (size_t)copyLength);
+        filled += copyLength;
     }
-    else if (bufferLen <= UINT16_MAX)
+}
+
+static void run_Parallel_Fill_Job(const parallelFillJob *job)
+{
+    for (uint64_t slice = job->firstSlice; slice < job->firstSlice + job->sliceCount; ++slice)
     {
-        offsetWidth = 4;
-        printf("\n          "); //0  1  2  3  4  5  6  7  8  9  A  B  C  D  E  F  ");
+        uint64_t offset = slice * PARALLEL_FILL_SLICE_SIZE;
+        uint64_t length = M_Min(PARALLEL_FILL_SLICE_SIZE, job->dataLength - offset);
+        if (job->fillType == PARALLEL_FILL_RANDOM)
+        {
+            //Each slice is its own generator. Stepping the SplitMix64 expansion past the values used by earlier slices keeps all of them unrelated, and slice 0 matches seed_Xoshiro128x4(seed).
+            xoshiro128x4State state;
+            seed_Xoshiro128x4(&state, job->seed + SPLITMIX64_INCREMENT * 2 * XOSHIRO128X4_LANES * slice);
+            fill_Random_Pattern_In_Buffer_Xoshiro128x4(&state, &job->ptrData[offset], length);
+        }
+        else
+        {
+            fill_Repeating_Pattern(job->pattern, job->patternLength, (uint32_t)(offset % job->patternLength), &job->ptrData[offset], length);
+        }
     }
-    else if (bufferLen <= 0xFFFFFF)
+}
+
+#if defined (_WIN32)
+static DWORD WINAPI parallel_Fill_Thread(LPVOID job)
+{
+    run_Parallel_Fill_Job((const parallelFillJob*)job);
+    return 0;
+}
+#else
+static void* parallel_Fill_Thread(void *job)
+{
+    run_Parallel_Fill_Job((const parallelFillJob*)job);
+    return NULL;
+}
+#endif
+
+static uint32_t get_Online_Processor_Count(void)
+{
+#if defined (_WIN32)
+    SYSTEM_INFO systemInfo;
+    memset(&systemInfo, 0, sizeof(SYSTEM_INFO));
+    GetSystemInfo(&systemInfo);
+    return systemInfo.dwNumberOfProcessors > 0 ? (uint32_t)systemInfo.dwNumberOfProcessors : 1;
+#elif defined (_SC_NPROCESSORS_ONLN)
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+    return processors > 0 ? (uint32_t)processors : 1;
+#else
+    return 1;
+#endif
+}
+
+//Splits the buffer into PARALLEL_FILL_SLICE_SIZE slices and hands a contiguous run of them to each thread. The calling thread takes the first run itself.
+//If a thread cannot be started, the calling thread fills that run too, so the buffer is always completely filled with the same data.
+static int parallel_Fill(parallelFillJob *jobTemplate, uint32_t threadCount)
+{
+    parallelFillJob jobs[PARALLEL_FILL_MAX_THREADS];
+#if defined (_WIN32)
+    HANDLE threads[PARALLEL_FILL_MAX_THREADS];
+#else
+    pthread_t threads[PARALLEL_FILL_MAX_THREADS];
+#endif
+    bool threadStarted[PARALLEL_FILL_MAX_THREADS] = { false };
+    uint64_t totalSlices = (jobTemplate->dataLength + PARALLEL_FILL_SLICE_SIZE - 1) / PARALLEL_FILL_SLICE_SIZE;
+    if (threadCount == 0)
     {
-        offsetWidth = 6;
-        printf("\n            "); //0  1  2  3  4  5  6  7  8  9  A  B  C  D  E  F  ");
+        threadCount = get_Online_Processor_Count();
     }
-    else//32bit width, don't care about 64bit since max size if 32bit
+    threadCount = (uint32_t)M_Min((uint64_t)M_Min(threadCount, PARALLEL_FILL_MAX_THREADS), totalSlices);
+    for (uint32_t threadIter = 0; threadIter < threadCount; ++threadIter)
     {
-        offsetWidth = 8;
-        printf("\n              "); //0  1  2  3  4  5  6  7  8  9  A  B  C  D  E  F  ");
+        jobs[threadIter] = *jobTemplate;
+        jobs[threadIter].firstSlice = totalSlices * threadIter / threadCount;
+        jobs[threadIter].sliceCount = totalSlices * (threadIter + 1) / threadCount - jobs[threadIter].firstSlice;
     }
-    //we print out 2 (0x) + printf formatting width + 2 (spaces) then the offsets
-
-    for (printIter = 0; printIter < 16 && printIter < bufferLen; printIter++)
+    for (uint32_t threadIter = 1; threadIter < threadCount; ++threadIter)
     {
-        printf("%"PRIX32"  ", printIter);
+#if defined (_WIN32)
+        threads[threadIter] = CreateThread(NULL, 0, parallel_Fill_Thread, &jobs[threadIter], 0, NULL);
+        threadStarted[threadIter] = threads[threadIter] != NULL;
+#else
+        threadStarted[threadIter] = 0 == pthread_create(&threads[threadIter], NULL, parallel_Fill_Thread, &jobs[threadIter]);
+#endif
     }
-    char lineBuff[18] = { 0 };
-    uint8_t lineBuffIter = 0;
-    for (printIter = 0, offset = 0; printIter < bufferLen; ++printIter, ++lineBuffIter)
+    for (uint32_t threadIter = 0; threadIter < threadCount; ++threadIter)
     {
-        if (lineBuffIter > sizeof(lineBuff))
-        {
-            lineBuffIter = 0;
-        }
-        //for every 16 bytes we print, we need to make a newline, then print the offset (hex) before we print the data again
-        if (printIter % 16 == 0)
-        {
-            switch (offsetWidth)
-            {
-            case 4:
-                printf("\n  0x%04"PRIX32" ", offset);
-                break;
-            case 6:
-                printf("\n  0x%06"PRIX32" ", offset);
-                break;
-            case 8:
-                printf("\n  0x%08"PRIX32" ", offset);
-                break;
-            case 2:
-            default:
-                printf("\n  0x%02"PRIX32" ", offset);
-                break;
-            }
-            offset += 16;
-        }
-        printf("%02"PRIX8" ", dataBuffer[printIter]);
-        if (showPrint)
+        if (!threadStarted[threadIter])
         {
-            if (isprint((int)dataBuffer[printIter]))
-            {
-                lineBuff[lineBuffIter] = dataBuffer[printIter];
-            }
-            else
-            {
-                lineBuff[lineBuffIter] = '.';
-            }
+            run_Parallel_Fill_Job(&jobs[threadIter]);
         }
-        if (showPrint && ((printIter + 1) % 16 == 0 || printIter + 1 == bufferLen))
+    }
+    for (uint32_t threadIter = 1; threadIter < threadCount; ++threadIter)
+    {
+        if (threadStarted[threadIter])
         {
-            lineBuff[17] = '\0';
-            lineBuffIter = UINT8_MAX;//this is done to cause an overflow when the ++happens during the loop
-            //need to calculate if padding is needed before printing character translations...but how...
-            uint32_t spacePadding = (printIter + 1) % 16;
-            if (spacePadding)
-            {
-                uint32_t counter = 0;
-                while (counter < ((16 - spacePadding)))
-                {
-                    printf("   ");
-                    counter++;
-                }
-            }
-            //space after last printed hex 
-            printf("  ");
-            printf("%s", lineBuff);
-            memset(lineBuff, 0, sizeof(lineBuff) / sizeof(*lineBuff));
+#if defined (_WIN32)
+            WaitForSingleObject(threads[threadIter], INFINITE);
+            CloseHandle(threads[threadIter]);
+#else
+            pthread_join(threads[threadIter], NULL);
+#endif
         }
     }
-    printf("\n\n");
+    return SUCCESS;
 }
 
-int metric_Unit_Convert(double *byteValue, char** metricUnit)
+int fill_Random_Pattern_In_Buffer_Parallel(uint64_t seed, uint8_t *ptrData, uint64_t dataLength, uint32_t threadCount)
 {
-    int ret = SUCCESS;
-    uint8_t unitCounter = 0;
-
-    while ((*byteValue / 1000.0) >= 1 && (unitCounter + 1) < 8)
+    parallelFillJob job;
+    if (!ptrData || dataLength == 0)
     {
-        *byteValue = *byteValue / 1000.00;
-        unitCounter += 1;
+        return BAD_PARAMETER;
     }
-    switch (unitCounter)
+    memset(&job, 0, sizeof(parallelFillJob));
+    job.fillType = PARALLEL_FILL_RANDOM;
+    job.seed = seed;
+    job.ptrData = ptrData;
+    job.dataLength = dataLength;
+    return parallel_Fill(&job, threadCount);
+}
+
+int fill_Hex_Pattern_In_Buffer_Parallel(uint32_t hexPattern, uint8_t *ptrData, uint64_t dataLength, uint32_t threadCount)
+{
+    parallelFillJob job;
+    uint8_t patternBytes[sizeof(uint32_t)];
+    if (!ptrData || dataLength < sizeof(uint32_t))
     {
-    case 0:
-        strcpy(*metricUnit, "B");
-        break;
-    case 1:
-        strcpy(*metricUnit, "KB");
-        break;
-    case 2:
-        strcpy(*metricUnit, "MB");
-        break;
-    case 3:
-        strcpy(*metricUnit, "GB");
-        break;
-    case 4:
-        strcpy(*metricUnit, "TB");
-        break;
-    case 5:
-        strcpy(*metricUnit, "PB");
-        break;
-    case 6:
-        strcpy(*metricUnit, "EB");
-        break;
-    case 7:
-        strcpy(*metricUnit, "ZB");
-        break;
-    case 8:
-        strcpy(*metricUnit, "YB");
-        break;
-    default:
-        ret = FAILURE;
+        return BAD_PARAMETER;
     }
-    return ret;
+    memcpy(patternBytes, &hexPattern, sizeof(uint32_t));//same byte order fill_Hex_Pattern_In_Buffer writes
+    memset(&job, 0, sizeof(parallelFillJob));
+    job.fillType = PARALLEL_FILL_REPEATING;
+    job.pattern = patternBytes;
+    job.patternLength = sizeof(uint32_t);
+    job.ptrData = ptrData;
+    //only whole 32bit words, like fill_Hex_Pattern_In_Buffer. Any trailing bytes are left alone.
+    job.dataLength = dataLength - (dataLength % sizeof(uint32_t));
+    return parallel_Fill(&job, threadCount);
 }
 
-int capacity_Unit_Convert(double *byteValue, char** capacityUnit)
+int fill_Incrementing_Pattern_In_Buffer_Parallel(uint8_t incrementStartValue, uint8_t *ptrData, uint64_t dataLength, uint32_t threadCount)
 {
-    int ret = SUCCESS;
-    uint8_t unitCounter = 0;
-
-    while ((*byteValue / 1024.0) >= 1 && (unitCounter + 1) < 8)
+    parallelFillJob job;
+    uint8_t patternBytes[UINT8_MAX + 1];
+    if (!ptrData || dataLength == 0)
     {
-        *byteValue = *byteValue / 1024.00;
-        unitCounter += 1;
+        return BAD_PARAMETER;
     }
-    switch (unitCounter)
+    for (uint16_t iter = 0; iter <= UINT8_MAX; ++iter)
     {
-    case 0:
-        strcpy(*capacityUnit, "B");
-        break;
-    case 1:
-        strcpy(*capacityUnit, "KiB");
-        break;
-    case 2:
-        strcpy(*capacityUnit, "MiB");
-        break;
-    case 3:
-        strcpy(*capacityUnit, "GiB");
-        break;
-    case 4:
-        strcpy(*capacityUnit, "TiB");
-        break;
-    case 5:
-        strcpy(*capacityUnit, "PiB");
-        break;
-    case 6:
-        strcpy(*capacityUnit, "EiB");
-        break;
-    case 7:
-        strcpy(*capacityUnit, "ZiB");
-        break;
-    case 8:
-        strcpy(*capacityUnit, "YiB");
-        break;
-    default:
-        ret = FAILURE;
+        patternBytes[iter] = incrementStartValue++;
     }
-    return ret;
+    memset(&job, 0, sizeof(parallelFillJob));
+    job.fillType = PARALLEL_FILL_REPEATING;
+    job.pattern = patternBytes;
+    job.patternLength = UINT8_MAX + 1;
+    job.ptrData = ptrData;
+    job.dataLength = dataLength;
+    return parallel_Fill(&job, threadCount);
 }
 
-void convert_Seconds_To_Displayable_Time(uint64_t secondsToConvert, uint8_t *years, uint8_t *days, uint8_t *hours, uint8_t *minutes, uint8_t *seconds)
+int fill_ASCII_Pattern_In_Buffer_Parallel(const char *asciiPattern, uint32_t patternLength, uint8_t *ptrData, uint64_t dataLength, uint32_t threadCount)
 {
-    uint64_t tempCalcValue = secondsToConvert;
-    //get seconds up to a maximum of 60
-    if (seconds)
+    parallelFillJob job;
+    if (!ptrData || patternLength == 0 || !asciiPattern || dataLength == 0)
     {
-        *seconds = (uint8_t)(tempCalcValue % 60);
+        return BAD_PARAMETER;
     }
-    tempCalcValue /= 60;
-    //get minutes up to a maximum of 60
-    if (minutes)
+    memset(&job, 0, sizeof(parallelFillJob));
+    job.fillType = PARALLEL_FILL_REPEATING;
+    job.pattern = (const uint8_t*)asciiPattern;
+    job.patternLength = patternLength;
+    job.ptrData = ptrData;
+    job.dataLength = dataLength;
+    return parallel_Fill(&job, threadCount);
+}
+
+//Counter based random pattern. The 8 bytes starting at every multiple of 8 in the stream are the SplitMix64 value for (seed, offset / 8), stored little endian, so any byte can be computed without generating the ones before it.
+M_STATIC_INLINE uint64_t random_Pattern_Word_At(uint64_t seed, uint64_t wordIndex)
+{
+    return splitmix64_Mix(seed + SPLITMIX64_INCREMENT * (wordIndex + 1));
+}
+
+int fill_Random_Pattern_At_Offset(uint64_t seed, uint64_t offset, uint8_t *ptrData, uint64_t dataLength)
+{
+    uint64_t wordIndex = offset / sizeof(uint64_t);
+    uint64_t iter = 0;
+    uint8_t byteInWord = (uint8_t)(offset % sizeof(uint64_t));
+    if (!ptrData || dataLength == 0)
     {
-        *minutes = (uint8_t)(tempCalcValue % 60);
+        return BAD_PARAMETER;
     }
-    tempCalcValue /= 60;
-    //get hours up to a maximum of 24
-    if (hours)
+    if (byteInWord > 0)
     {
-        *hours = (uint8_t)(tempCalcValue % 24);
+        //offset is not on a word boundary, so the first few bytes come from the end of a word
+        uint8_t wordBytes[sizeof(uint64_t)];
+        le64_Store(wordBytes, random_Pattern_Word_At(seed, wordIndex++));
+        iter = M_Min((uint64_t)(sizeof(uint64_t) - byteInWord), dataLength);
+        memcpy(ptrData, &wordBytes[byteInWord], (size_t)iter);
     }
-    tempCalcValue /= 24;
-    //get days up to 365
-    if (days)
+    for (; iter + sizeof(uint64_t) <= dataLength; iter += sizeof(uint64_t))
     {
-        *days = (uint8_t)(tempCalcValue % 365);
+        le64_Store(&ptrData[iter], random_Pattern_Word_At(seed, wordIndex++));
     }
-    tempCalcValue /= 365;
-    //get years
-    if (years)
+    if (iter < dataLength)
     {
-        *years = (uint8_t)(tempCalcValue);
+        uint8_t wordBytes[sizeof(uint64_t)];
+        le64_Store(wordBytes, random_Pattern_Word_At(seed, wordIndex));
+        memcpy(&ptrData[iter], wordBytes, (size_t)(dataLength - iter));
     }
+    return SUCCESS;
 }
 
-void print_Time_To_Screen(uint8_t *years, uint8_t *days, uint8_t *hours, uint8_t *minutes, uint8_t *seconds)
+int verify_Random_Pattern_At_Offset(uint64_t seed, uint64_t offset, const uint8_t *ptrData, uint64_t dataLength, uint64_t *firstMismatchOffset)
 {
-    if (years && *years > 0)
+    uint64_t wordIndex = offset / sizeof(uint64_t);
+    uint64_t iter = 0;
+    uint8_t byteInWord = (uint8_t)(offset % sizeof(uint64_t));
+    if (!ptrData || dataLength == 0)
     {
-        printf(" %"PRIu8" year", *years);
-        if (*years > 1)
-        {
-            printf("s");
-        }
+        return BAD_PARAMETER;
     }
-    if (days && *days > 0)
+    //the partial words at the start and end are checked a byte at a time. Everything else is compared a whole word at a time, and only a word that differs is searched for the first byte that differs.
+    if (byteInWord > 0)
     {
-        printf(" %"PRIu8" day", *days);
-        if (*days > 1)
+        uint8_t wordBytes[sizeof(uint64_t)];
+        le64_Store(wordBytes, random_Pattern_Word_At(seed, wordIndex++));
+        for (; byteInWord < sizeof(uint64_t) && iter < dataLength; ++byteInWord, ++iter)
         {
-            printf("s");
+            if (ptrData[iter] != wordBytes[byteInWord])
+            {
+                if (firstMismatchOffset)
+                {
+                    *firstMismatchOffset = offset + iter;
+                }
+                return FAILURE;
+            }
         }
     }
-    if (hours && *hours > 0)
+    for (; iter + sizeof(uint64_t) <= dataLength; iter += sizeof(uint64_t))
     {
-        printf(" %"PRIu8" hour", *hours);
-        if (*hours > 1)
+        uint64_t difference = le64_Load(&ptrData[iter]) ^ random_Pattern_Word_At(seed, wordIndex++);
+        if (difference)
         {
-            printf("s");
+            if (firstMismatchOffset)
+            {
+                *firstMismatchOffset = offset + iter + lowest_Set_Bit_64(difference) / 8;
+            }
+            return FAILURE;
         }
     }
-    if (minutes && *minutes > 0)
+    if (iter < dataLength)
     {
-        printf(" %"PRIu8" minute", *minutes);
-        if (*minutes > 1)
+        uint8_t wordBytes[sizeof(uint64_t)];
+        le64_Store(wordBytes, random_Pattern_Word_At(seed, wordIndex));
+        for (uint8_t byteIter = 0; iter < dataLength; ++byteIter, ++iter)
         {
-            printf("s");
+            if (ptrData[iter] != wordBytes[byteIter])
+            {
+                if (firstMismatchOffset)
+                {
+                    *firstMismatchOffset = offset + iter;
+                }
+                return FAILURE;
+            }
         }
     }
-    if (seconds && *seconds > 0)
+    return SUCCESS;
+}
+
+double convert_128bit_to_double(uint8_t * pData)
+{
+    seauint128_t value = uint128_From_LE_Bytes(pData);
+    //2^64 as a double
+    return ((double)uint128_Upper(value) * 18446744073709551616.0) + (double)uint128_Lower(value);
+}
+
+seauint128_t uint128_Divide_By_Uint32(seauint128_t dividend, uint32_t divisor, uint32_t *remainder)
+{
+#if defined (OPENSEA_NATIVE_UINT128)
+    if (remainder)
+    {
+        *remainder = (uint32_t)(dividend % divisor);
+    }
+    return dividend / divisor;
+#else
+    //long division, 32 bits at a time, so that every step fits in a 64bit value
+    uint32_t limbs[4] = { M_DoubleWord1(dividend.upper), M_DoubleWord0(dividend.upper), M_DoubleWord1(dividend.lower), M_DoubleWord0(dividend.lower) };
+    uint64_t partial = 0;
+    for (uint8_t limbIter = 0; limbIter < 4; ++limbIter)
     {
-        printf(" %"PRIu8" second", *seconds);
-        if (*seconds > 1)
-        {
-            printf("s");
-        }
+        partial = (partial << 32) | limbs[limbIter];
+        limbs[limbIter] = (uint32_t)(partial / divisor);
+        partial %= divisor;
     }
-    if (years || days || hours || minutes || seconds)
+    if (remainder)
     {
-        printf(" ");
+        *remainder = (uint32_t)partial;
     }
+    return uint128_Make(M_DWordsTo8ByteValue(limbs[0], limbs[1]), M_DWordsTo8ByteValue(limbs[2], limbs[3]));
+#endif
 }
 
-uint32_t seed32Array[2] = { 0x05EAF00D, 0x05EA51DE };
-uint64_t seed64Array[2] = { 0x05EAF00D, 0x05EA51DE };
-
-void seed_32(uint32_t seed)
+size_t uint128_To_Decimal_String(seauint128_t value, char *buffer, size_t bufferSize)
 {
-    //first initialize
-    seed32Array[0] = seed;
-    seed32Array[1] = (uint32_t)((int32_t)seed >> 1);//converting to signed int to perform arithmetic shift, then back for the seed value
-    //using that initialization, run the random number generator for a more random seed...may or may not be needed, but I'm doing this anyways - Tyler
-    seed32Array[0] = xorshiftplus32();
-    seed32Array[0] = xorshiftplus32();
+    char digits[UINT128_DECIMAL_STRING_LENGTH] = { 0 };
+    char *digitsEnd = &digits[UINT128_DECIMAL_STRING_LENGTH - 1];
+    size_t digitCount = 0;
+    if (!buffer)
+    {
+        return 0;
+    }
+    //peel off 9 decimal digits at a time with 32bit divisions until the value fits in 64bits, then convert the rest directly
+    while (uint128_Upper(value) > 0)
+    {
+        uint32_t chunk = 0;
+        value = uint128_Divide_By_Uint32(value, UINT32_C(1000000000), &chunk);
+        digitCount += uint64_To_Decimal_Digits(chunk, digitsEnd - digitCount, 9);
+    }
+    digitCount += uint64_To_Decimal_Digits(uint128_Lower(value), digitsEnd - digitCount, 0);
+    if (digitCount + 1 > bufferSize)
+    {
+        return 0;
+    }
+    memcpy(buffer, digitsEnd - digitCount, digitCount);
+    buffer[digitCount] = '\0';
+    return digitCount;
 }
-void seed_64(uint64_t seed)
+
+void load_128bit_LE_Array(const uint8_t *pData, seauint128_t *values, size_t count)
 {
-    //first initialize
-    seed64Array[0] = seed;
-    seed64Array[1] = (uint64_t)((int64_t)seed >> 2);//converting to signed int to perform arithmetic shift, then back for the seed value
-    //using that initialization, run the random number generator for a more random seed...may or may not be needed, but I'm doing this anyways - Tyler
-    seed64Array[0] = xorshiftplus64();
-    seed64Array[0] = xorshiftplus64();
+    if (!pData || !values)
+    {
+        return;
+    }
+    for (size_t iter = 0; iter < count; ++iter)
+    {
+        values[iter] = uint128_From_LE_Bytes(&pData[iter * 16]);
+    }
 }
 
-//shift values chosen randomly
-uint32_t xorshiftplus32(void)
+size_t format_Uint64_Decimal(uint64_t value, char *buffer, size_t bufferSize)
 {
-    uint32_t x = seed32Array[0];
-    uint32_t const y = seed32Array[1];
-    seed32Array[0] = y;
-    x ^= x << 13;//a
-    seed32Array[1] = x ^ y ^ (x >> 17) ^ (y >> 7); //b, c
-    return (seed32Array[1] + y);
+    char digits[UINT64_DECIMAL_STRING_LENGTH] = { 0 };
+    size_t digitCount = uint64_To_Decimal_Digits(value, &digits[UINT64_DECIMAL_STRING_LENGTH - 1], 0);
+    if (!buffer || digitCount + 1 > bufferSize)
+    {
+        return 0;
+    }
+    memcpy(buffer, &digits[UINT64_DECIMAL_STRING_LENGTH - 1 - digitCount], digitCount);
+    buffer[digitCount] = '\0';
+    return digitCount;
 }
 
-//shift values chosen randomly
-uint64_t xorshiftplus64(void)
+size_t format_Int64_Decimal(int64_t value, char *buffer, size_t bufferSize)
 {
-    uint64_t x = seed64Array[0];
-    uint64_t const y = seed64Array[1];
-    seed64Array[0] = y;
-    x ^= x << 27;//a
-    seed64Array[1] = x ^ y ^ (x >> 13) ^ (y >> 32); //b, c
-    return (seed64Array[1] + y);
+    char digits[INT64_DECIMAL_STRING_LENGTH] = { 0 };
+    //negate as unsigned so that INT64_MIN does not overflow
+    uint64_t magnitude = value < 0 ? UINT64_C(0) - (uint64_t)value : (uint64_t)value;
+    size_t length = uint64_To_Decimal_Digits(magnitude, &digits[INT64_DECIMAL_STRING_LENGTH - 1], 0);
+    if (value < 0)
+    {
+        ++length;
+        digits[INT64_DECIMAL_STRING_LENGTH - 1 - length] = '-';
+    }
+    if (!buffer || length + 1 > bufferSize)
+    {
+        return 0;
+    }
+    memcpy(buffer, &digits[INT64_DECIMAL_STRING_LENGTH - 1 - length], length);
+    buffer[length] = '\0';
+    return length;
 }
 
-uint32_t random_Range_32(uint32_t rangeMin, uint32_t rangeMax)
+size_t format_Uint64_Hex(uint64_t value, uint8_t width, char *buffer, size_t bufferSize)
 {
-    //doing this to prevent a possible overflow
-    if (rangeMax == UINT32_MAX)
+    char digits[16] = { 0 };
+    size_t digitCount = uint64_To_Hex_Digits(value, digits, width);
+    if (!buffer || digitCount + 1 > bufferSize)
     {
-        rangeMax -= 1;
+        return 0;
     }
-    //this will slightly bias the randomness...but not enough for us to care at this point in time
-    //return (xorshiftplus32() % (rangeMax + 1 - rangeMin) + rangeMin);
-
-    //This method below should return unbiased results. see http://c-faq.com/lib/randrange.html
-    return (rangeMin + xorshiftplus32() / (UINT32_MAX / (rangeMax - rangeMin + 1) + 1));
+    memcpy(buffer, &digits[16 - digitCount], digitCount);
+    buffer[digitCount] = '\0';
+    return digitCount;
 }
-uint64_t random_Range_64(uint64_t rangeMin, uint64_t rangeMax)
+
+size_t format_Int64_Hex(int64_t value, uint8_t width, char *buffer, size_t bufferSize)
 {
-    //doing this to prevent a possible overflow
-    if (rangeMax == UINT64_MAX)
+    char digits[16] = { 0 };
+    uint64_t magnitude = value < 0 ? UINT64_C(0) - (uint64_t)value : (uint64_t)value;
+    size_t digitCount = uint64_To_Hex_Digits(magnitude, digits, width);
+    size_t length = digitCount + (value < 0 ? 1 : 0);
+    if (!buffer || length + 1 > bufferSize)
     {
-        rangeMax -= 1;
+        return 0;
     }
-    //this will slightly bias the randomness...but not enough for us to care at this point in time
-    //return (xorshiftplus64() % (rangeMax + 1 - rangeMin) + rangeMin);
-
-    //This method below should return unbiased results. see http://c-faq.com/lib/randrange.html
-    return (rangeMin + xorshiftplus64() / (UINT64_MAX / (rangeMax - rangeMin + 1) + 1));
+    if (value < 0)
+    {
+        buffer[0] = '-';
+    }
+    memcpy(&buffer[length - digitCount], &digits[16 - digitCount], digitCount);
+    buffer[length] = '\0';
+    return length;
 }
 
-int fill_Random_Pattern_In_Buffer(uint8_t *ptrData, uint32_t dataLength)
+//Civil from days is from Howard Hinnant's date algorithms (http://howardhinnant.github.io/date_algorithms.html)
+//It works on 400 year eras (146097 days) with years starting in March so that the leap day is the last day of the year.
+void civil_From_Days(int64_t daysSinceEpoch, int64_t *year, uint8_t *month, uint8_t *day)
 {
-    uint32_t *localPtr = (uint32_t*)ptrData;
-    if (dataLength < sizeof(uint32_t) || !ptrData)
+    int64_t era = 0, dayOfEra = 0, yearOfEra = 0, dayOfYear = 0, shiftedMonth = 0;
+    uint8_t civilMonth = 0;
+    daysSinceEpoch += 719468;
+    era = (daysSinceEpoch >= 0 ? daysSinceEpoch : daysSinceEpoch - 146096) / 146097;
+    dayOfEra = daysSinceEpoch - era * 146097;//[0, 146096]
+    yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;//[0, 399]
+    dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);//[0, 365]
+    shiftedMonth = (5 * dayOfYear + 2) / 153;//[0, 11] starting from March
+    civilMonth = (uint8_t)(shiftedMonth < 10 ? shiftedMonth + 3 : shiftedMonth - 9);
+    if (year)
     {
-        return BAD_PARAMETER;
+        *year = yearOfEra + era * 400 + (civilMonth <= 2 ? 1 : 0);
     }
-    seed_32((uint32_t)time(NULL));
-    for (uint32_t iter = 0; iter < (dataLength / sizeof(uint32_t)); ++iter)
+    if (month)
     {
-        localPtr[iter] = xorshiftplus32();
+        *month = civilMonth;
+    }
+    if (day)
+    {
+        *day = (uint8_t)(dayOfYear - (153 * shiftedMonth + 2) / 5 + 1);
     }
-    return SUCCESS;
 }
 
-int fill_Hex_Pattern_In_Buffer(uint32_t hexPattern, uint8_t *ptrData, uint32_t dataLength)
+struct tm* get_Localtime(const time_t *timer, struct tm *localTime)
 {
-    uint32_t *localPtr = (uint32_t*)ptrData;
-    if (!ptrData || dataLength < sizeof(uint32_t))
+    if (!timer || !localTime)
     {
-        return BAD_PARAMETER;
+        return NULL;
     }
-    for (uint32_t iter = 0; iter < (dataLength / sizeof(uint32_t)); ++iter)
+#if defined (_WIN32)
+    if (0 != localtime_s(localTime, timer))
     {
-        localPtr[iter] = hexPattern;
+        return NULL;
     }
-    return SUCCESS;
+    return localTime;
+#elif defined (_POSIX_VERSION)
+    return localtime_r(timer, localTime);
+#else
+    //no reentrant version available. Copy the result out as quickly as possible.
+    struct tm *sharedTime = localtime(timer);
+    if (!sharedTime)
+    {
+        return NULL;
+    }
+    memcpy(localTime, sharedTime, sizeof(struct tm));
+    return localTime;
+#endif
 }
 
-int fill_Incrementing_Pattern_In_Buffer(uint8_t incrementStartValue, uint8_t *ptrData, uint32_t dataLength)
+//Per thread cache of the last timestamp string. Everything up to the minute is reused until the minute changes, so most calls only rewrite the last few digits.
+typedef struct _timestampCache
 {
-    if (!ptrData)
-    {
-        return BAD_PARAMETER;
+    bool valid;
+    int64_t baseSecond;//time the date/time text was built from
+    int64_t validUntil;//first second where the text has to be rebuilt (the next minute)
+    int64_t lastSecond;//time the seconds digits currently represent
+    uint8_t baseTmSec;//seconds of the minute at baseSecond
+    size_t secondsOffset;//index of the seconds digits in timestamp
+    char timestamp[TIMESTAMP_STRING_LENGTH];
+}timestampCache;
+
+static M_THREAD_LOCAL timestampCache localTimestampCache;
+static M_THREAD_LOCAL timestampCache utcTimestampCache;
+
+static void rebuild_Timestamp_Cache(timestampCache *cache, eTimestampFormat format, int64_t now)
+{
+    int64_t year = 0;
+    uint8_t month = 0, day = 0, hour = 0, minute = 0, second = 0;
+    int length = 0;
+    if (format == TIMESTAMP_FORMAT_UTC)
+    {
+        //UTC never needs the time zone database, so skip gmtime entirely
+        int64_t days = now / 86400;
+        int64_t secondOfDay = now % 86400;
+        if (secondOfDay < 0)
+        {
+            secondOfDay += 86400;
+            --days;
+        }
+        civil_From_Days(days, &year, &month, &day);
+        hour = (uint8_t)(secondOfDay / 3600);
+        minute = (uint8_t)((secondOfDay / 60) % 60);
+        second = (uint8_t)(secondOfDay % 60);
     }
-    for (uint32_t iter = 0; iter < dataLength; ++iter)
+    else
     {
-        ptrData[iter] = incrementStartValue++;
+        time_t currentTime = (time_t)now;
+        struct tm localTime;
+        memset(&localTime, 0, sizeof(struct tm));
+        if (!get_Localtime(&currentTime, &localTime))
+        {
+            //leave the cache invalid so the next call tries again
+            cache->valid = false;
+            snprintf(cache->timestamp, TIMESTAMP_STRING_LENGTH, "%s", TIMESTAMP_UNKNOWN_STRING);
+            return;
+        }
+        year = localTime.tm_year + INT64_C(1900);
+        month = (uint8_t)(localTime.tm_mon + 1);
+        day = (uint8_t)localTime.tm_mday;
+        hour = (uint8_t)localTime.tm_hour;
+        minute = (uint8_t)localTime.tm_min;
+        second = (uint8_t)localTime.tm_sec;
+    }
+    length = snprintf(cache->timestamp, TIMESTAMP_STRING_LENGTH, "%04"PRId64"-%02"PRIu8"-%02"PRIu8"T%02"PRIu8":%02"PRIu8":%02"PRIu8, year, month, day, hour, minute, second);
+    if (length < 2 || length > TIMESTAMP_STRING_LENGTH - 7)//need room for .mmmZ and a null terminator
+    {
+        cache->valid = false;
+        snprintf(cache->timestamp, TIMESTAMP_STRING_LENGTH, "%s", TIMESTAMP_UNKNOWN_STRING);
+        return;
     }
-    return SUCCESS;
+    cache->secondsOffset = (size_t)length - 2;
+    cache->baseSecond = now;
+    cache->lastSecond = now;
+    cache->baseTmSec = second;
+    //a leap second (tm_sec == 60) just leaves the cache valid for nothing, so the next call rebuilds it.
+    cache->validUntil = now + (second < 60 ? 60 - second : 0);
+    cache->valid = true;
 }
 
-int fill_ASCII_Pattern_In_Buffer(const char *asciiPattern, uint32_t patternLength, uint8_t *ptrData, uint32_t dataLength)
+const char* get_Current_Timestamp(eTimestampFormat format, time_t *currentTime)
 {
-    if (!ptrData || patternLength == 0 || !asciiPattern)
+    timestampCache *cache = format == TIMESTAMP_FORMAT_UTC ? &utcTimestampCache : &localTimestampCache;
+    int64_t now = 0;
+    uint32_t nanoseconds = 0, milliseconds = 0;
+    char *suffix = NULL;
+    get_Coarse_Wall_Clock(&now, &nanoseconds);
+    if (currentTime)
     {
-        return BAD_PARAMETER;
+        *currentTime = (time_t)now;
     }
-    for (uint32_t iter = 0; iter < dataLength; iter += patternLength)
+    if (!cache->valid || now < cache->baseSecond || now >= cache->validUntil)
+    {
+        rebuild_Timestamp_Cache(cache, format, now);
+        if (!cache->valid)
+        {
+            return cache->timestamp;
+        }
+    }
+    else if (now != cache->lastSecond)
     {
-        memcpy(&ptrData[iter], asciiPattern, M_Min(patternLength, dataLength - iter));
+        //same minute as the cached text. Only the seconds digits move.
+        uint8_t second = (uint8_t)(cache->baseTmSec + (now - cache->baseSecond));
+        cache->timestamp[cache->secondsOffset] = (char)('0' + second / 10);
+        cache->timestamp[cache->secondsOffset + 1] = (char)('0' + second % 10);
+        cache->lastSecond = now;
     }
-    return SUCCESS;
-}
-
-int fill_Pattern_Buffer_Into_Another_Buffer(uint8_t *inPattern, uint32_t inpatternLength, uint8_t *ptrData, uint32_t dataLength)
-{
-    if (!ptrData || inpatternLength == 0 || !inPattern || dataLength == 0)
+    milliseconds = nanoseconds / 1000000;
+    suffix = &cache->timestamp[cache->secondsOffset + 2];
+    suffix[0] = '.';
+    suffix[1] = (char)('0' + milliseconds / 100);
+    suffix[2] = (char)('0' + (milliseconds / 10) % 10);
+    suffix[3] = (char)('0' + milliseconds % 10);
+    if (format == TIMESTAMP_FORMAT_UTC)
     {
-        return BAD_PARAMETER;
+        suffix[4] = 'Z';
+        suffix[5] = '\0';
     }
-    for (uint32_t iter = 0; iter < dataLength; iter += inpatternLength)
+    else
     {
-        memcpy(&ptrData[iter], inPattern, M_Min(inpatternLength, dataLength - iter));
+        suffix[4] = '\0';
     }
-    return SUCCESS;
+    return cache->timestamp;
 }
 
-double convert_128bit_to_double(uint8_t * pData)
+void update_Current_Time(void)
 {
-    double result = 0;
-    int i;
-    for (i = 0; i < 16; i++) {
-        result *= 256;
-        result += pData[15 - i];
-    }
-    return result;
+    const char *timestamp = get_Current_Timestamp(TIMESTAMP_FORMAT_LOCAL, &g_currentTime);
+    snprintf(g_currentTimeString, sizeof(g_currentTimeString), "%s", timestamp);
+    g_currentTimeStringPtr = g_currentTimeString;
 }
 
+//POSIX and Windows (every system this library supports) store time_t as a signed count of seconds since Jan 1, 1970 UTC, so the seconds are added directly.
 time_t get_Future_Date_And_Time(time_t inputTime, uint64_t secondsInTheFuture)
 {
-    uint8_t years = 0, months = 0, days = 0, hours = 0, minutes = 0, seconds = 0;
-    struct tm futureTime = *localtime((const time_t*)&inputTime);
-    //first break the input time into seperate units
-    convert_Seconds_To_Displayable_Time(secondsInTheFuture, &years, &days, &hours, &minutes, &seconds);
-    //now start setting the future time struct and checking when incrementing things for overflow
-    //start with seconds
-    if (seconds > 0)
-    {
-        if (futureTime.tm_sec + seconds > 59)
-        {
-            //increment minutes since we will adjust that next
-            minutes++;
-            futureTime.tm_sec = futureTime.tm_sec + seconds - 60;
-        }
-        else
-        {
-            futureTime.tm_sec += seconds;
-        }
-    }
-    //now minutes
-    if (minutes > 0)
+    //largest value a signed time_t can hold. Saturate there instead of wrapping around into the past.
+    const uint64_t timeMax = (UINT64_C(1) << (sizeof(time_t) * 8 - 1)) - 1;
+    if (inputTime < 0)
     {
-        if (futureTime.tm_min + minutes > 59)
-        {
-            hours++;
-            futureTime.tm_min = futureTime.tm_min + minutes - 60;
-        }
-        else
+        //negate as unsigned so that the smallest time_t does not overflow
+        uint64_t timeBeforeEpoch = UINT64_C(0) - (uint64_t)inputTime;
+        if (secondsInTheFuture < timeBeforeEpoch)
         {
-            futureTime.tm_min += minutes;
+            //still before the epoch, so the result fits
+            return (time_t)(inputTime + (time_t)secondsInTheFuture);
         }
+        secondsInTheFuture -= timeBeforeEpoch;
+        return secondsInTheFuture > timeMax ? (time_t)timeMax : (time_t)secondsInTheFuture;
     }
-    //now hours
-    if (hours > 0)
+    if (secondsInTheFuture > timeMax - (uint64_t)inputTime)
     {
-        if (futureTime.tm_hour + hours > 23)
-        {
-            days++;
-            futureTime.tm_hour = futureTime.tm_hour + hours - 24;
-        }
-        else
-        {
-            futureTime.tm_hour += hours;
-        }
+        return (time_t)timeMax;
     }
-    //now days (including week day information)
-    if (days > 0)
+    return (time_t)((uint64_t)inputTime + secondsInTheFuture);
+}
+
+void get_Future_Date_And_Time_Array(time_t inputTime, const uint64_t *secondsInTheFuture, time_t *futureTimes, size_t count)
+{
+    if (!secondsInTheFuture || !futureTimes)
     {
-        //day of the year
-        if (futureTime.tm_yday + days > 365)
-        {
-            years++;
-            futureTime.tm_yday = futureTime.tm_yday + days - 366;
-        }
-        else
-        {
-            futureTime.tm_yday += days;
-        }
-        //day of the week
-        if (futureTime.tm_wday + days > 6)
-        {
-            futureTime.tm_wday = futureTime.tm_wday + days - 7;
-        }
-        else
-        {
-            futureTime.tm_wday += days;
-        }
-        //day of the month (depends on the month!)
-        uint8_t numberOfDaysInMonth = 31;//assume the most common
-        switch (futureTime.tm_mon)
-        {
-        case 0://january
-        case 2://march
-        case 4://may
-        case 6://july
-        case 7://august
-        case 9://october
-        case 11://december
-            //31 days a month
-            numberOfDaysInMonth = 31;
-            break;
-        case 3://april
-        case 5://june
-        case 8://september
-        case 10://november
-            //30 days a month
-            numberOfDaysInMonth = 30;
-            break;
-        case 1://february
-            //28 days a month (do we need to handle leap year?)
-            if (futureTime.tm_year % 400 == 0)
-            {
-                //leap year
-                numberOfDaysInMonth = 29;
-            }
-            else if (futureTime.tm_year % 100 == 0)
-            {
-                //not a leap year
-                numberOfDaysInMonth = 28;
-            }
-            else if (futureTime.tm_year % 4 == 0)
-            {
-                //leap year
-                numberOfDaysInMonth = 29;
-            }
-            else
-            {
-                //not a leap year
-                numberOfDaysInMonth = 28;
-            }
-            break;
-        default://do nothing
-            break;
-        }
-        if (futureTime.tm_mday + days > numberOfDaysInMonth)
-        {
-            months++;
-            futureTime.tm_mday = futureTime.tm_mday + days - (numberOfDaysInMonth + 1);
-        }
-        else
-        {
-            futureTime.tm_mday += days;
-        }
+        return;
     }
-    //now months
-    if (months > 0)
+    for (size_t iter = 0; iter < count; ++iter)
     {
-        if (futureTime.tm_mon + months > 11)
-        {
-            years++;
-            futureTime.tm_mon = futureTime.tm_mon + months - 12;
-        }
-        else
-        {
-            futureTime.tm_mon += months;
-        }
+        futureTimes[iter] = get_Future_Date_And_Time(inputTime, secondsInTheFuture[iter]);
     }
-    //now years
-    if (years > 0)
-    {
-        //since 1900...just increment since no range applies today
-        futureTime.tm_year += years;
-    }    
-    return mktime(&futureTime);
 }
 
 int get_Compiler_Info(eCompiler *compilerUsed, ptrCompilerVersion compilerVersionInfo)
@@ -1024,43 +3337,33 @@ int get_Compiler_Info(eCompiler *compilerUsed, ptrCompilerVersion compilerVersio
     return ret;
 }
 
-void print_Compiler(eCompiler compilerUsed)
+static const char *compilerStrings[] =
 {
-    switch (compilerUsed)
+    "Unknown Compiler",         //OPENSEA_COMPILER_UNKNOWN
+    "Microsoft Visual C/C++",   //OPENSEA_COMPILER_MICROSOFT_VISUAL_C_CPP
+    "GCC",                      //OPENSEA_COMPILER_GCC
+    "Clang",                    //OPENSEA_COMPILER_CLANG
+    "MinGW",                    //OPENSEA_COMPILER_MINGW
+    "Intel C/C++",              //OPENSEA_COMPILER_INTEL_C_CPP
+    "Oracle Sunpro C/C++",      //OPENSEA_COMPILER_SUNPRO_C_CPP
+    "IBM XL C/C++",             //OPENSEA_COMPILER_IBM_XL_C_CPP
+    "IBM XL C/C++ for SystemZ", //OPENSEA_COMPILER_IBM_SYSTEMZ_C_CPP
+    "HP aCC",                   //OPENSEA_COMPILER_HP_A_CPP
+};
+M_STATIC_ASSERT(sizeof(compilerStrings) / sizeof(compilerStrings[0]) == OPENSEA_COMPILER_RESERVED, compilerStrings_matches_eCompiler);
+
+const char* get_Compiler_String(eCompiler compilerUsed)
+{
+    if ((size_t)compilerUsed < sizeof(compilerStrings) / sizeof(compilerStrings[0]))
     {
-    case OPENSEA_COMPILER_MICROSOFT_VISUAL_C_CPP:
-        printf("Microsoft Visual C/C++");
-        break;
-    case OPENSEA_COMPILER_GCC:
-        printf("GCC");
-        break;
-    case OPENSEA_COMPILER_CLANG:
-        printf("Clang");
-        break;
-    case OPENSEA_COMPILER_MINGW:
-        printf("MinGW");
-        break;
-    case OPENSEA_COMPILER_INTEL_C_CPP:
-        printf("Intel C/C++");
-        break;
-    case OPENSEA_COMPILER_SUNPRO_C_CPP:
-        printf("Oracle Sunpro C/C++");
-        break;
-    case OPENSEA_COMPILER_IBM_XL_C_CPP:
-        printf("IBM XL C/C++");
-        break;
-    case OPENSEA_COMPILER_IBM_SYSTEMZ_C_CPP:
-        printf("IBM XL C/C++ for SystemZ");
-        break;
-    case OPENSEA_COMPILER_HP_A_CPP:
-        printf("HP aCC");
-        break;
-    case OPENSEA_COMPILER_UNKNOWN:
-    case OPENSEA_COMPILER_RESERVED:
-    default:
-        printf("Unknown Compiler");
-        break;
+        return compilerStrings[compilerUsed];
     }
+    return compilerStrings[OPENSEA_COMPILER_UNKNOWN];
+}
+
+void print_Compiler(eCompiler compilerUsed)
+{
+    printf("%s", get_Compiler_String(compilerUsed));
 }
 
 void print_Compiler_Version_Info(ptrCompilerVersion compilerVersionInfo)
@@ -1080,21 +3383,236 @@ long int get_File_Size(FILE *filePtr)
     return fileSize;
 }
 
+void string_Builder_Init(stringBuilder *builder, char *buffer, size_t bufferSize, bool allowGrowth)
+{
+    if (!builder)
+    {
+        return;
+    }
+    builder->buffer = bufferSize > 0 ? buffer : NULL;
+    builder->length = 0;
+    builder->capacity = builder->buffer ? bufferSize : 0;
+    builder->allowGrowth = allowGrowth;
+    builder->ownsBuffer = false;
+    builder->truncated = false;
+    if (builder->buffer)
+    {
+        builder->buffer[0] = '\0';
+    }
+}
+
+void string_Builder_Free(stringBuilder *builder)
+{
+    if (!builder)
+    {
+        return;
+    }
+    if (builder->ownsBuffer)
+    {
+        safe_Free(builder->buffer);
+    }
+    builder->buffer = NULL;
+    builder->length = 0;
+    builder->capacity = 0;
+    builder->ownsBuffer = false;
+    builder->truncated = false;
+}
+
+void string_Builder_Reset(stringBuilder *builder)
+{
+    if (!builder)
+    {
+        return;
+    }
+    builder->length = 0;
+    builder->truncated = false;
+    if (builder->buffer)
+    {
+        builder->buffer[0] = '\0';
+    }
+}
+
+//makes sure there is room for additionalLength more characters plus the null terminator. Returns SUCCESS or an error if the buffer could not be made large enough.
+static int string_Builder_Reserve(stringBuilder *builder, size_t additionalLength)
+{
+    size_t required = builder->length + additionalLength + 1;
+    size_t newCapacity = builder->capacity > 0 ? builder->capacity : 64;
+    char *newBuffer = NULL;
+    if (required <= builder->capacity)
+    {
+        return SUCCESS;
+    }
+    if (!builder->allowGrowth)
+    {
+        return FAILURE;
+    }
+    if (required < builder->length)
+    {
+        //size overflowed
+        return MEMORY_FAILURE;
+    }
+    while (newCapacity < required)
+    {
+        newCapacity = newCapacity * 2 > newCapacity ? newCapacity * 2 : required;
+    }
+    if (builder->ownsBuffer)
+    {
+        newBuffer = (char*)realloc(builder->buffer, newCapacity);
+    }
+    else
+    {
+        //moving off of the caller's buffer, so copy what has been built so far.
+        newBuffer = (char*)malloc(newCapacity);
+        if (newBuffer)
+        {
+            if (builder->buffer)
+            {
+                memcpy(newBuffer, builder->buffer, builder->length);
+            }
+            newBuffer[builder->length] = '\0';
+        }
+    }
+    if (!newBuffer)
+    {
+        return MEMORY_FAILURE;
+    }
+    builder->buffer = newBuffer;
+    builder->capacity = newCapacity;
+    builder->ownsBuffer = true;
+    return SUCCESS;
+}
+
+int string_Builder_Append(stringBuilder *builder, const char *string, size_t length)
+{
+    int ret = SUCCESS;
+    if (!builder || (!string && length > 0))
+    {
+        return BAD_PARAMETER;
+    }
+    ret = string_Builder_Reserve(builder, length);
+    if (ret != SUCCESS)
+    {
+        //append as much as fits
+        builder->truncated = true;
+        if (builder->capacity == 0)
+        {
+            return ret;
+        }
+        length = M_Min(length, builder->capacity - 1 - builder->length);
+    }
+    memcpy(&builder->buffer[builder->length], string, length);
+    builder->length += length;
+    builder->buffer[builder->length] = '\0';
+    return ret;
+}
+
+int string_Builder_Append_String(stringBuilder *builder, const char *string)
+{
+    if (!string)
+    {
+        return BAD_PARAMETER;
+    }
+    return string_Builder_Append(builder, string, strlen(string));
+}
+
+int string_Builder_Append_Char(stringBuilder *builder, char character)
+{
+    return string_Builder_Append(builder, &character, 1);
+}
+
+int string_Builder_Append_Uint64(stringBuilder *builder, uint64_t value)
+{
+    char digits[UINT64_DECIMAL_STRING_LENGTH] = { 0 };
+    return string_Builder_Append(builder, digits, format_Uint64_Decimal(value, digits, UINT64_DECIMAL_STRING_LENGTH));
+}
+
+int string_Builder_Append_Hex(stringBuilder *builder, uint64_t value, uint8_t minDigits)
+{
+    char digits[UINT64_HEX_STRING_LENGTH] = { 0 };
+    return string_Builder_Append(builder, digits, format_Uint64_Hex(value, minDigits, digits, UINT64_HEX_STRING_LENGTH));
+}
+
+int string_Builder_Append_Format(stringBuilder *builder, const char *format, ...)
+{
+    int ret = SUCCESS;
+    int formattedLength = 0;
+    va_list args;
+    if (!builder || !format)
+    {
+        return BAD_PARAMETER;
+    }
+    //try formatting into the space that is already available first and only grow when that is not enough.
+    va_start(args, format);
+#if defined (_MSC_VER) && _MSC_VER < 1900
+    //vsnprintf before VS2015 returns -1 instead of the full length when the output does not fit, so get the length on its own first
+    formattedLength = _vscprintf(format, args);
+    va_end(args);
+    va_start(args, format);
+    if (formattedLength >= 0 && builder->buffer)
+    {
+        vsnprintf(&builder->buffer[builder->length], builder->capacity - builder->length, format, args);
+    }
+#else
+    formattedLength = vsnprintf(builder->buffer ? &builder->buffer[builder->length] : NULL, builder->buffer ? builder->capacity - builder->length : 0, format, args);
+#endif
+    va_end(args);
+    if (formattedLength < 0)
+    {
+        if (builder->buffer)
+        {
+            builder->buffer[builder->length] = '\0';
+        }
+        return FAILURE;
+    }
+    if (builder->length + (size_t)formattedLength < builder->capacity)
+    {
+        builder->length += (size_t)formattedLength;
+        return SUCCESS;
+    }
+    ret = string_Builder_Reserve(builder, (size_t)formattedLength);
+    if (ret == SUCCESS)
+    {
+        va_start(args, format);
+        vsnprintf(&builder->buffer[builder->length], builder->capacity - builder->length, format, args);
+        va_end(args);
+        builder->length += (size_t)formattedLength;
+    }
+    else
+    {
+        //vsnprintf already wrote as much as would fit. Older MSVC runtimes do not null terminate a truncated string, so always do it here.
+        builder->truncated = true;
+        if (builder->capacity > 0)
+        {
+            builder->length = builder->capacity - 1;
+            builder->buffer[builder->length] = '\0';
+        }
+    }
+    return ret;
+}
+
 void SendJSONMessage (char *JSONname, char *JSONvalue, custom_Update updateFunction, void *updateData)
 {
-  char message[MAX_JSON_MSG];
-  snprintf(message, MAX_JSON_MSG, "{\"%s\":\"%s\"}", JSONname, JSONvalue);
-  if (updateFunction != NULL) 
+  char messageBuffer[MAX_JSON_MSG];
+  stringBuilder message;
+  if (updateFunction == NULL)
   {
-      updateFunction(updateData, message); // Call the custom UI update
+      return;
   }
+  string_Builder_Init(&message, messageBuffer, MAX_JSON_MSG, true);
+  string_Builder_Append(&message, "{\"", 2);
+  string_Builder_Append_String(&message, JSONname);
+  string_Builder_Append(&message, "\":\"", 3);
+  string_Builder_Append_String(&message, JSONvalue);
+  string_Builder_Append(&message, "\"}", 2);
+  updateFunction(updateData, message.buffer); // Call the custom UI update
+  string_Builder_Free(&message);
   //printf("JSON Message:  %s\n",message);
 }
 
 void SendJSONProgress (int progress, custom_Update updateFunction, void *updateData )
 {
-  char message[MAX_JSON_MSG];
-  snprintf(message, MAX_JSON_MSG, "%d", (int) progress);
+  char message[INT64_DECIMAL_STRING_LENGTH];
+  format_Int64_Decimal(progress, message, INT64_DECIMAL_STRING_LENGTH);
 
   SendJSONMessage ("Progress", message, updateFunction, updateData);
 }
@@ -1262,83 +3780,199 @@ int WriteJSONPair (char *name, char *val, JSONContext *context)       //   "name
     int retCode = FAILURE;
     SendCrComma (context);
     SendIndentation (context);
-    char message[MAX_JSON_MSG];
-    snprintf(message, MAX_JSON_MSG, "\"%s\": \"%s\"", name, val);
-    context->updateFunction(context->updateData, message); 
+    char messageBuffer[MAX_JSON_MSG];
+    stringBuilder message;
+    string_Builder_Init(&message, messageBuffer, MAX_JSON_MSG, true);
+    string_Builder_Append_Char(&message, '\"');
+    string_Builder_Append_String(&message, name);
+    string_Builder_Append(&message, "\": \"", 4);
+    string_Builder_Append_String(&message, val);
+    string_Builder_Append_Char(&message, '\"');
+    context->updateFunction(context->updateData, message.buffer); 
+    string_Builder_Free(&message);
     context->entriesFilled[context->currentDepth]++;  // Running count of number of entries at the current depth
     return (retCode);
 }
 
 int get_And_Validate_Integer_Input(const char * strToConvert, uint64_t * outputInteger)
 {
-	int ret = true; 
-	bool hex = false;
-	const char * tmp = strToConvert;
-	while (*tmp != '\0')
-	{
-		if ( (!isxdigit(*tmp)) && (*tmp != 'x') && (*tmp != 'h') )
-		{
-			ret = false;
-			break;
-		}
-		else if (!isdigit(*tmp))
-		{
-			hex = true;
-		}
-		tmp++;
-	}
-	//If everything is a valid hex digit. 
-	//TODO: What about realllyyyy long hex value? 
-	if (ret == true )
-	{
-		if ( hex )
-		{
-			*outputInteger = strtol(strToConvert, NULL, 16);
-		}
-		else
-		{
-			*outputInteger = strtol(strToConvert, NULL, 10);
-		}
-	}
-	else
-	{
-		ret = false; 
-	}
-	//Final Check
-	if (ret == true && errno != 0 && * outputInteger == 0)
-	{
-		ret = false;
-	}
-
-	return ret;
+    return parse_Unsigned_Integer(strToConvert, outputInteger) == INTEGER_PARSE_SUCCESS ? true : false;
 }
 
-void print_Errno_To_Screen(int error)
+eIntegerParseResult parse_Unsigned_Integer(const char *strToConvert, uint64_t *outputInteger)
 {
-#if defined (__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && defined (__STDC_LIB_EXT1__)//This last piece must be defined by the compiler for this to be used...Only will be set if user defined __STDC_WANT_LIB_EXT1__
-    size_t errorStringLen = strerrorlen_s(error);
-    char *errorString = (char*)calloc(errorStringLen + 1, sizeof(char));
-    if (errorString)
+    const char *iter = strToConvert;
+    uint64_t decimalValue = 0, hexValue = 0;
+    bool decimalOverflow = false, hexOverflow = false;
+    bool hexPrefix = false, hexSuffix = false, hexDigitFound = false;
+    size_t digitCount = 0;
+    if (!outputInteger)
     {
-        strerror(errorString, errorStringLen + 1, error);//returns 0 if whole string fits, nonzero if it was truncatd
-        printf("%d - %s\n", error, errorString);
+        return INTEGER_PARSE_BAD_PARAMETER;
     }
-    else
+    if (!strToConvert || *strToConvert == '\0')
+    {
+        return INTEGER_PARSE_EMPTY;
+    }
+    if (iter[0] == '0' && (iter[1] == 'x' || iter[1] == 'X'))
+    {
+        hexPrefix = true;
+        iter += 2;
+    }
+    //Until the whole string has been seen it is not known whether this is decimal or hex, so build both values at once instead of scanning the string twice.
+    for (; *iter != '\0'; ++iter)
+    {
+        uint8_t digit = 0;
+        char character = *iter;
+        if (character >= '0' && character <= '9')
+        {
+            digit = (uint8_t)(character - '0');
+        }
+        else if ((character | 0x20) >= 'a' && (character | 0x20) <= 'f')
+        {
+            digit = (uint8_t)((character | 0x20) - 'a' + 10);
+            hexDigitFound = true;
+        }
+        else if ((character | 0x20) == 'h' && iter[1] == '\0' && !hexPrefix && digitCount > 0)
+        {
+            hexSuffix = true;
+            break;
+        }
+        else
+        {
+            return INTEGER_PARSE_INVALID_CHARACTER;
+        }
+        ++digitCount;
+        if (hexValue > (UINT64_MAX >> 4))
+        {
+            hexOverflow = true;
+        }
+        hexValue = (hexValue << 4) | digit;
+        if (digit < 10 && !decimalOverflow)
+        {
+            if (decimalValue > (UINT64_MAX - digit) / 10)
+            {
+                decimalOverflow = true;
+            }
+            decimalValue = decimalValue * 10 + digit;
+        }
+    }
+    if (digitCount == 0)
     {
-        printf("%d - <Unable to convert error to string>\n", error);
+        return INTEGER_PARSE_EMPTY;
     }
-    safe_Free(errorString);
-#elif defined (_MSC_VER) //TODO: Check for a specific version of visual studio?
-    char errorString[1024] = { 0 };
-    if(0 == strerror_s(errorString, 1024, error))
+    if (hexPrefix || hexSuffix || hexDigitFound)
     {
-        printf("%d - %s\n", error, errorString);
+        if (hexOverflow)
+        {
+            return INTEGER_PARSE_OVERFLOW;
+        }
+        *outputInteger = hexValue;
     }
     else
     {
-        printf("%d - <Unable to convert error to string>\n", error);
+        if (decimalOverflow)
+        {
+            return INTEGER_PARSE_OVERFLOW;
+        }
+        *outputInteger = decimalValue;
+    }
+    return INTEGER_PARSE_SUCCESS;
+}
+
+size_t parse_Unsigned_Integer_Array(const char * const *stringsToConvert, size_t count, uint64_t *outputIntegers, eIntegerParseResult *results)
+{
+    size_t successCount = 0;
+    if (!stringsToConvert || !outputIntegers)
+    {
+        return 0;
+    }
+    for (size_t iter = 0; iter < count; ++iter)
+    {
+        eIntegerParseResult result = parse_Unsigned_Integer(stringsToConvert[iter], &outputIntegers[iter]);
+        if (result == INTEGER_PARSE_SUCCESS)
+        {
+            ++successCount;
+        }
+        else
+        {
+            outputIntegers[iter] = 0;
+        }
+        if (results)
+        {
+            results[iter] = result;
+        }
+    }
+    return successCount;
+}
+
+//Error numbers below this are looked up once and kept in errnoStringTable. Anything else is reported as unknown.
+#define ERRNO_STRING_TABLE_COUNT 160
+#define ERRNO_STRING_MAX_LENGTH 80
+static char errnoStringTable[ERRNO_STRING_TABLE_COUNT][ERRNO_STRING_MAX_LENGTH];
+
+static void fill_Errno_String_Table(void)
+{
+    for (int error = 0; error < ERRNO_STRING_TABLE_COUNT; ++error)
+    {
+        char *tableEntry = errnoStringTable[error];
+#if defined (_MSC_VER) || (defined (__STDC_LIB_EXT1__) && defined (__STDC_WANT_LIB_EXT1__))
+        if (0 != strerror_s(tableEntry, ERRNO_STRING_MAX_LENGTH, error))
+        {
+            snprintf(tableEntry, ERRNO_STRING_MAX_LENGTH, "Unknown error %d", error);
+        }
+#elif defined (__GLIBC__) && defined (_GNU_SOURCE)
+        //GNU version may return a pointer to a static string instead of filling in the buffer
+        const char *errorString = strerror_r(error, tableEntry, ERRNO_STRING_MAX_LENGTH);
+        if (errorString != tableEntry)
+        {
+            snprintf(tableEntry, ERRNO_STRING_MAX_LENGTH, "%s", errorString);
+        }
+#elif defined (_POSIX_C_SOURCE) && _POSIX_C_SOURCE >= 200112L
+        //XSI version
+        if (0 != strerror_r(error, tableEntry, ERRNO_STRING_MAX_LENGTH))
+        {
+            snprintf(tableEntry, ERRNO_STRING_MAX_LENGTH, "Unknown error %d", error);
+        }
+#else
+        //strerror is not thread safe, but this only runs once under the once-only guard below
+        snprintf(tableEntry, ERRNO_STRING_MAX_LENGTH, "%s", strerror(error));
+#endif
+    }
+}
+
+#if defined (_WIN32)
+static INIT_ONCE errnoStringTableOnce = INIT_ONCE_STATIC_INIT;
+static BOOL CALLBACK fill_Errno_String_Table_Once(PINIT_ONCE initOnce, PVOID parameter, PVOID *context)
+{
+    (void)initOnce;
+    (void)parameter;
+    (void)context;
+    fill_Errno_String_Table();
+    return TRUE;
+}
+#else
+static pthread_once_t errnoStringTableOnce = PTHREAD_ONCE_INIT;
+#endif
+
+const char* get_Errno_String(int error)
+{
+    if (error < 0 || error >= ERRNO_STRING_TABLE_COUNT)
+    {
+        //keep the number, like strerror does, so that different unknown errors can still be told apart
+        static M_THREAD_LOCAL char unknownErrorString[ERRNO_STRING_MAX_LENGTH];
+        snprintf(unknownErrorString, ERRNO_STRING_MAX_LENGTH, "Unknown error %d", error);
+        return unknownErrorString;
     }
+#if defined (_WIN32)
+    InitOnceExecuteOnce(&errnoStringTableOnce, fill_Errno_String_Table_Once, NULL, NULL);
 #else
-    printf("%d - %s\n", error, strerror(error));
+    pthread_once(&errnoStringTableOnce, fill_Errno_String_Table);
 #endif
+    return errnoStringTable[error];
+}
+
+void print_Errno_To_Screen(int error)
+{
+    printf("%d - %s\n", error, get_Errno_String(error));
 }
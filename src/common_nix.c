@@ -656,3 +656,30 @@ double get_Seconds(seatimer_t timer)
 {
     return (get_Milli_Seconds(timer) / 1000.00);
 }
+
+void get_Coarse_Wall_Clock(int64_t *secondsSinceEpoch, uint32_t *nanoseconds)
+{
+    struct timespec now;
+    memset(&now, 0, sizeof(struct timespec));
+#if defined (CLOCK_REALTIME_COARSE)
+    //Linux only. Read from the vDSO without a syscall at the cost of tick resolution
+    if (0 != clock_gettime(CLOCK_REALTIME_COARSE, &now))
+#elif defined (CLOCK_REALTIME_FAST)
+    //FreeBSD's name for the same thing
+    if (0 != clock_gettime(CLOCK_REALTIME_FAST, &now))
+#else
+    if (0 != clock_gettime(CLOCK_REALTIME, &now))
+#endif
+    {
+        now.tv_sec = time(NULL);
+        now.tv_nsec = 0;
+    }
+    if (secondsSinceEpoch)
+    {
+        *secondsSinceEpoch = (int64_t)now.tv_sec;
+    }
+    if (nanoseconds)
+    {
+        *nanoseconds = (uint32_t)now.tv_nsec;
+    }
+}
@@ -16,153 +16,93 @@
 
 //This file should only really exist for some things like printing things out that would be common and not specific to an OS-TJE
 
+static const char *architectureStrings[] =
+{
+    "Unkown Architecture",  //OPENSEA_ARCH_UNKNOWN
+    "X86",                  //OPENSEA_ARCH_X86
+    "X86_64",               //OPENSEA_ARCH_X86_64
+    "ARM",                  //OPENSEA_ARCH_ARM
+    "ARM64",                //OPENSEA_ARCH_ARM64
+    "PPC",                  //OPENSEA_ARCH_POWERPC
+    "PPC64",                //OPENSEA_ARCH_POWERPC64
+    "IA64",                 //OPENSEA_ARCH_IA_64
+    "SPARC",                //OPENSEA_ARCH_SPARC
+    "Alpha",                //OPENSEA_ARCH_ALPHA
+    "SystemZ",              //OPENSEA_ARCH_SYSTEMZ
+    "MIPS",                 //OPENSEA_ARCH_MIPS
+};
+M_STATIC_ASSERT(sizeof(architectureStrings) / sizeof(architectureStrings[0]) == OPENSEA_ARCH_RESERVED, architectureStrings_matches_eArchitecture);
+
+const char* get_Architecture_String(eArchitecture arch)
+{
+    if ((size_t)arch < sizeof(architectureStrings) / sizeof(architectureStrings[0]))
+    {
+        return architectureStrings[arch];
+    }
+    return architectureStrings[OPENSEA_ARCH_UNKNOWN];
+}
+
 void print_Architecture(eArchitecture arch)
 {
-    switch (arch)
+    printf("%s", get_Architecture_String(arch));
+}
+
+//short and long names for each endianness. The last entry is used for anything unknown.
+static const char *endiannessStrings[][2] =
+{
+    { "LSB", "Little Endian" },         //OPENSEA_LITTLE_ENDIAN
+    { "MSB", "Big Endian" },            //OPENSEA_BIG_ENDIAN
+    { "LSW", "Little Endian (Word)" },  //OPENSEA_LITTLE_WORD_ENDIAN
+    { "MSW", "Big Endian (Word)" },     //OPENSEA_BIG_WORD_ENDIAN
+    { "???", "Unknown Endianness" },    //OPENSEA_UNKNOWN_ENDIAN
+};
+M_STATIC_ASSERT(sizeof(endiannessStrings) / sizeof(endiannessStrings[0]) == OPENSEA_UNKNOWN_ENDIAN + 1, endiannessStrings_matches_eEndianness);
+
+const char* get_Endianness_String(eEndianness endian, bool shortPrint)
+{
+    size_t index = (size_t)endian;
+    if (index > OPENSEA_UNKNOWN_ENDIAN)
     {
-    case OPENSEA_ARCH_X86:
-        printf("X86");
-        break;
-    case OPENSEA_ARCH_X86_64:
-        printf("X86_64");
-        break;
-    case OPENSEA_ARCH_ARM:
-        printf("ARM");
-        break;
-    case OPENSEA_ARCH_ARM64:
-        printf("ARM64");
-        break;
-    case OPENSEA_ARCH_POWERPC:
-        printf("PPC");
-        break;
-    case OPENSEA_ARCH_POWERPC64:
-        printf("PPC64");
-        break;
-    case OPENSEA_ARCH_IA_64:
-        printf("IA64");
-        break;
-    case OPENSEA_ARCH_SPARC:
-        printf("SPARC");
-        break;
-    case OPENSEA_ARCH_ALPHA:
-        printf("Alpha");
-        break;
-    case OPENSEA_ARCH_SYSTEMZ:
-        printf("SystemZ");
-        break;
-    case OPENSEA_ARCH_MIPS:
-        printf("MIPS");
-        break;
-    case OPENSEA_ARCH_UNKNOWN:
-    case OPENSEA_ARCH_RESERVED:
-    default:
-        printf("Unkown Architecture");
-        break;
+        index = OPENSEA_UNKNOWN_ENDIAN;
     }
+    return endiannessStrings[index][shortPrint ? 0 : 1];
 }
 
 void print_Endianness(eEndianness endian, bool shortPrint)
 {
-    switch (endian)
+    printf("%s", get_Endianness_String(endian, shortPrint));
+}
+
+static const char *osTypeStrings[] =
+{
+    "Unknown OS",       //OS_UNKNOWN
+    "Windows",          //OS_WINDOWS
+    "Linux",            //OS_LINUX
+    "FreeBSD",          //OS_FREEBSD
+    "Solaris",          //OS_SOLARIS
+    "Mac OSX",          //OS_MACOSX
+    "AIX",              //OS_AIX
+    "TRU64",            //OS_TRU64
+    "OpenBSD",          //OS_OPENBSD
+    "NetBSD",           //OS_NETBSD
+    "Dragonfly BSD",    //OS_DRAGONFLYBSD
+    "HP UX",            //OS_HPUX
+    "VMWare ESX",       //OS_ESX
+};
+M_STATIC_ASSERT(sizeof(osTypeStrings) / sizeof(osTypeStrings[0]) == OS_ESX + 1, osTypeStrings_matches_eOSType);
+
+const char* get_OS_Type_String(eOSType osType)
+{
+    if ((size_t)osType < sizeof(osTypeStrings) / sizeof(osTypeStrings[0]))
     {
-    case OPENSEA_LITTLE_ENDIAN:
-        if (shortPrint)
-        {
-            printf("LSB");
-        }
-        else
-        {
-            printf("Little Endian");
-        }
-        break;
-    case OPENSEA_BIG_ENDIAN:
-        if (shortPrint)
-        {
-            printf("MSB");
-        }
-        else
-        {
-            printf("Big Endian");
-        }
-        break;
-    case OPENSEA_LITTLE_WORD_ENDIAN:
-        if (shortPrint)
-        {
-            printf("LSW");
-        }
-        else
-        {
-            printf("Little Endian (Word)");
-        }
-        break;
-    case OPENSEA_BIG_WORD_ENDIAN:
-        if (shortPrint)
-        {
-            printf("MSW");
-        }
-        else
-        {
-            printf("Big Endian (Word)");
-        }
-        break;
-    default:
-        if (shortPrint)
-        {
-            printf("???");
-        }
-        else
-        {
-            printf("Unknown Endianness");
-        }
-        break;
+        return osTypeStrings[osType];
     }
+    return osTypeStrings[OS_UNKNOWN];
 }
 
 void print_OS_Type(eOSType osType)
 {
-    switch (osType)
-    {
-    case OS_WINDOWS:
-        printf("Windows");
-        break;
-    case OS_LINUX:
-        printf("Linux");
-        break;
-    case OS_FREEBSD:
-        printf("FreeBSD");
-        break;
-    case OS_SOLARIS:
-        printf("Solaris");
-        break;
-    case OS_MACOSX:
-        printf("Mac OSX");
-        break;
-    case OS_AIX:
-        printf("AIX");
-        break;
-    case OS_TRU64:
-        printf("TRU64");
-        break;
-    case OS_OPENBSD:
-        printf("OpenBSD");
-        break;
-    case OS_NETBSD:
-        printf("NetBSD");
-        break;
-    case OS_DRAGONFLYBSD:
-        printf("Dragonfly BSD");
-        break;
-    case OS_HPUX:
-        printf("HP UX");
-        break;
-    case OS_ESX:
-        printf("VMWare ESX");
-        break;
-    case OS_UNKNOWN:
-    default:
-        printf("Unknown OS");
-        break;
-    }
+    printf("%s", get_OS_Type_String(osType));
 }
 
 void print_OS_Version(ptrOSVersionNumber versionNumber)
@@ -232,8 +172,14 @@ int replace_File_Name_In_Path(char fullPath[OPENSEA_PATH_MAX], char *newFileName
     {
         return FAILURE;
     }
-    //now that we have a valid pointer, set all the remaining characters to null, then set the new file name in place.
-    memset(ptr, 0, strlen(ptr));
-    strcat(ptr, newFileName);
+    //now that we have a valid pointer, write the new file name in place of the old one without running past the end of the path buffer.
+    //Check that it fits first so that fullPath is left alone if it does not.
+    size_t spaceForFileName = OPENSEA_PATH_MAX - (size_t)(ptr - fullPath);
+    size_t newFileNameLength = 0;
+    if (!newFileName || (newFileNameLength = strlen(newFileName) + 1) > spaceForFileName)
+    {
+        return FAILURE;
+    }
+    memcpy(ptr, newFileName, newFileNameLength);
     return SUCCESS;
 }
\ No newline at end of file
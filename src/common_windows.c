@@ -721,6 +721,33 @@ double get_Seconds(seatimer_t timer)
     return (get_Milli_Seconds(timer) / 1000.00);
 }
 
+void get_Coarse_Wall_Clock(int64_t *secondsSinceEpoch, uint32_t *nanoseconds)
+{
+    //FILETIME counts 100ns intervals since Jan 1, 1601 UTC. This is the number of those intervals up to Jan 1, 1970 UTC.
+    const uint64_t unixEpochIn100ns = UINT64_C(116444736000000000);
+    FILETIME now;
+    uint64_t intervals = 0;
+    memset(&now, 0, sizeof(FILETIME));
+    GetSystemTimeAsFileTime(&now);
+    intervals = ((uint64_t)now.dwHighDateTime << 32) | now.dwLowDateTime;
+    if (intervals >= unixEpochIn100ns)
+    {
+        intervals -= unixEpochIn100ns;
+    }
+    else
+    {
+        intervals = 0;
+    }
+    if (secondsSinceEpoch)
+    {
+        *secondsSinceEpoch = (int64_t)(intervals / 10000000);
+    }
+    if (nanoseconds)
+    {
+        *nanoseconds = (uint32_t)(intervals % 10000000) * 100;
+    }
+}
+
 void print_Windows_Error_To_Screen(unsigned int windowsError)
 {
     LPSTR windowsErrorString = NULL;